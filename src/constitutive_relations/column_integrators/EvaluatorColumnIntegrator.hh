@@ -22,6 +22,7 @@ Clients should provide a struct functor that does the actual work, and returns
 
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -116,6 +117,7 @@ EvaluatorColumnIntegrator<Parser, Integrator>::Evaluate_(
   const State& S,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   // collect the dependencies and mesh, and instantiate the integrator functor
   std::vector<const Epetra_MultiVector*> deps;
   for (const auto& dep : dependencies_) {
@@ -157,6 +159,7 @@ EvaluatorColumnIntegrator<Parser, Integrator>::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(false); // not reachable, IsDifferentiableWRT() always false
 }
 
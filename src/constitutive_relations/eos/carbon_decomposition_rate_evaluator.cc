@@ -14,6 +14,7 @@
 */
 
 #include "carbon_decomposition_rate_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -51,6 +52,7 @@ CarbonDecomposeRateEvaluator::Clone() const
 void
 CarbonDecomposeRateEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Epetra_MultiVector& res_c = *result[0]->ViewComponent("cell", false);
   AMANZI_ASSERT(res_c.MyLength() == 0); // this PK only valid on column mesh
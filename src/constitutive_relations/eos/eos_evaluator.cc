@@ -14,6 +14,7 @@
 
 #include "eos_factory.hh"
 #include "eos_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -150,6 +151,7 @@ EOSEvaluator::Clone() const
 void
 EOSEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   int num_dep = dependencies_.size();
   std::vector<double> eos_params(num_dep);
   std::vector<const CompositeVector*> dep_cv;
@@ -241,6 +243,7 @@ EOSEvaluator::EvaluatePartialDerivative_(const State& S,
                                          const Tag& wrt_tag,
                                          const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   int num_dep = dependencies_.size();
   std::vector<double> eos_params(num_dep);
   std::vector<const CompositeVector*> dep_cv;
@@ -14,6 +14,7 @@
 
 #include "vapor_pressure_relation_factory.hh"
 #include "molar_fraction_gas_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -42,6 +43,7 @@ MolarFractionGasEvaluator::Clone() const
 void
 MolarFractionGasEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   // Pull dependencies out of state.
   Teuchos::RCP<const CompositeVector> temp = S.GetPtr<CompositeVector>(temp_key_, tag);
@@ -67,6 +69,7 @@ MolarFractionGasEvaluator::EvaluatePartialDerivative_(const State& S,
                                                       const Tag& wrt_tag,
                                                       const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   AMANZI_ASSERT(wrt_key == temp_key_);
 
@@ -14,6 +14,7 @@
 
 #include "viscosity_relation_factory.hh"
 #include "viscosity_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -46,6 +47,7 @@ ViscosityEvaluator::Clone() const
 void
 ViscosityEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   // Pull dependencies out of state.
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> temp = S.GetPtr<CompositeVector>(temp_key_, tag);
@@ -70,6 +72,7 @@ ViscosityEvaluator::EvaluatePartialDerivative_(const State& S,
                                                const Tag& wrt_tag,
                                                const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(wrt_key == temp_key_);
 
   // Pull dependencies out of state.
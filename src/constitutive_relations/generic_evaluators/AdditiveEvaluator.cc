@@ -13,6 +13,7 @@
 */
 
 #include "AdditiveEvaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -55,6 +56,7 @@ AdditiveEvaluator::Clone() const
 void
 AdditiveEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   result[0]->PutScalar(shift_);
 
   for (const auto& key_tag : dependencies_) {
@@ -77,6 +79,7 @@ AdditiveEvaluator::EvaluatePartialDerivative_(const State& S,
                                               const Tag& wrt_tag,
                                               const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   result[0]->PutScalar(coefs_[Keys::getKey(wrt_key, wrt_tag)]);
 
   if (positive_) {
@@ -0,0 +1,55 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include "dbc.hh"
+#include "BoundaryFaceMap.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+BoundaryFaceMap::BoundaryFaceMap(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+{
+  const Epetra_Map& vandelay_map = mesh->getMap(AmanziMesh::Entity_kind::BOUNDARY_FACE, false);
+  const Epetra_Map& face_map = mesh->getMap(AmanziMesh::Entity_kind::FACE, false);
+
+  int nbfaces = vandelay_map.NumMyElements();
+  face.resize(nbfaces);
+  cell.resize(nbfaces);
+  for (int bf = 0; bf != nbfaces; ++bf) {
+    AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
+    auto cells = mesh->getFaceCells(f);
+    AMANZI_ASSERT(cells.size() == 1);
+    face[bf] = f;
+    cell[bf] = cells[0];
+  }
+}
+
+
+void
+requireBoundaryFaceMap(State& S, const Key& domain)
+{
+  Key key = Keys::getKey(domain, "boundary_face_map");
+  if (!S.HasRecord(key, Tags::DEFAULT)) {
+    S.Require<BoundaryFaceMap>(S.GetMesh(domain), key, Tags::DEFAULT, key);
+    auto& record = S.GetRecordW(key, Tags::DEFAULT, key);
+    record.set_initialized();
+    record.set_io_vis(false);
+    record.set_io_checkpoint(false);
+  }
+}
+
+
+const BoundaryFaceMap&
+getBoundaryFaceMap(const State& S, const Key& domain)
+{
+  return S.Get<BoundaryFaceMap>(Keys::getKey(domain, "boundary_face_map"), Tags::DEFAULT);
+}
+
+} // namespace Relations
+} // namespace Amanzi
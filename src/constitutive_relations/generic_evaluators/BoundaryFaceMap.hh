@@ -0,0 +1,54 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*!
+
+Contiguous maps from each owned boundary face of a mesh to its face and to
+its (unique) interior cell.
+
+Evaluators that need the interior cell of a boundary face, e.g. to choose
+the model of the region containing it, would otherwise go through the face
+and boundary face maps and the face-to-cell adjacency of the mesh on every
+evaluation.  These maps are stored in State, one per domain under the key
+`"DOMAIN-boundary_face_map"`, so they are shared by all evaluators on a mesh
+and live as long as it.  Each evaluator requires the map during setup; it
+is built then and only read afterwards, so callers may be on different
+threads.  Mesh topology is assumed not to change once the map is built.
+
+*/
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "Key.hh"
+#include "Mesh.hh"
+#include "State.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+struct BoundaryFaceMap {
+  explicit BoundaryFaceMap(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+  std::vector<AmanziMesh::Entity_ID> face; // bf -> f
+  std::vector<AmanziMesh::Entity_ID> cell; // bf -> interior cell
+};
+
+// Requires the map of the mesh of domain in S, building it on first call.
+void
+requireBoundaryFaceMap(State& S, const Key& domain);
+
+// Returns the map of the mesh of domain, which must have been required.
+const BoundaryFaceMap&
+getBoundaryFaceMap(const State& S, const Key& domain);
+
+} // namespace Relations
+} // namespace Amanzi
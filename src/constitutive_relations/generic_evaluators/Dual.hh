@@ -0,0 +1,316 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*!
+
+Forward-mode automatic differentiation with respect to N variables.
+
+A Dual<N> carries a value and its gradient with respect to N independent
+variables.  A model written once as a template over its scalar type,
+
+.. code-block:: c++
+
+    template <typename Scalar>
+    Scalar Energy(const Scalar& phi, const Scalar& sl, ...) const;
+
+evaluates the value with Scalar = double, and the value and full gradient in
+one evaluation with Scalar = Dual<N>, where argument i is seeded by
+Dual<N>::Variable(x_i, i).  Shared subexpressions are then computed once,
+rather than once per hand-written partial derivative.
+
+Math functions are found by argument-dependent lookup, so templated models
+should bring in the double versions with e.g. `using std::pow;` and call them
+unqualified.  Comparisons compare values only, so branches follow the value
+as they would for doubles.
+
+*/
+#pragma once
+
+#include <cmath>
+
+namespace Amanzi {
+
+template <int N>
+class Dual {
+ public:
+  // a constant, with zero gradient
+  Dual(double v = 0.) : v_(v)
+  {
+    for (int j = 0; j != N; ++j) d_[j] = 0.;
+  }
+
+  // independent variable i
+  static Dual Variable(double v, int i)
+  {
+    Dual x(v);
+    x.d_[i] = 1.;
+    return x;
+  }
+
+  double value() const { return v_; }
+  double d(int i) const { return d_[i]; }
+
+  Dual& operator+=(const Dual& o)
+  {
+    v_ += o.v_;
+    for (int j = 0; j != N; ++j) d_[j] += o.d_[j];
+    return *this;
+  }
+  Dual& operator-=(const Dual& o)
+  {
+    v_ -= o.v_;
+    for (int j = 0; j != N; ++j) d_[j] -= o.d_[j];
+    return *this;
+  }
+  Dual& operator*=(const Dual& o)
+  {
+    for (int j = 0; j != N; ++j) d_[j] = d_[j] * o.v_ + v_ * o.d_[j];
+    v_ *= o.v_;
+    return *this;
+  }
+  Dual& operator/=(const Dual& o)
+  {
+    double inv = 1. / o.v_;
+    v_ *= inv;
+    for (int j = 0; j != N; ++j) d_[j] = (d_[j] - v_ * o.d_[j]) * inv;
+    return *this;
+  }
+
+  Dual& operator+=(double o)
+  {
+    v_ += o;
+    return *this;
+  }
+  Dual& operator-=(double o)
+  {
+    v_ -= o;
+    return *this;
+  }
+  Dual& operator*=(double o)
+  {
+    v_ *= o;
+    for (int j = 0; j != N; ++j) d_[j] *= o;
+    return *this;
+  }
+  Dual& operator/=(double o)
+  {
+    v_ /= o;
+    for (int j = 0; j != N; ++j) d_[j] /= o;
+    return *this;
+  }
+
+  // f(x) given f and f' at the value of x
+  Dual Chain(double f, double df) const
+  {
+    Dual r(f);
+    for (int j = 0; j != N; ++j) r.d_[j] = df * d_[j];
+    return r;
+  }
+
+ private:
+  double v_;
+  double d_[N];
+};
+
+
+//
+// arithmetic
+//
+template <int N>
+Dual<N>
+operator-(const Dual<N>& a)
+{
+  return a * -1.;
+}
+
+template <int N>
+Dual<N>
+operator+(Dual<N> a, const Dual<N>& b)
+{
+  return a += b;
+}
+template <int N>
+Dual<N>
+operator+(Dual<N> a, double b)
+{
+  return a += b;
+}
+template <int N>
+Dual<N>
+operator+(double a, Dual<N> b)
+{
+  return b += a;
+}
+
+template <int N>
+Dual<N>
+operator-(Dual<N> a, const Dual<N>& b)
+{
+  return a -= b;
+}
+template <int N>
+Dual<N>
+operator-(Dual<N> a, double b)
+{
+  return a -= b;
+}
+template <int N>
+Dual<N>
+operator-(double a, const Dual<N>& b)
+{
+  return -b + a;
+}
+
+template <int N>
+Dual<N>
+operator*(Dual<N> a, const Dual<N>& b)
+{
+  return a *= b;
+}
+template <int N>
+Dual<N>
+operator*(Dual<N> a, double b)
+{
+  return a *= b;
+}
+template <int N>
+Dual<N>
+operator*(double a, Dual<N> b)
+{
+  return b *= a;
+}
+
+template <int N>
+Dual<N>
+operator/(Dual<N> a, const Dual<N>& b)
+{
+  return a /= b;
+}
+template <int N>
+Dual<N>
+operator/(Dual<N> a, double b)
+{
+  return a /= b;
+}
+template <int N>
+Dual<N>
+operator/(double a, const Dual<N>& b)
+{
+  return Dual<N>(a) /= b;
+}
+
+
+//
+// comparisons, on values
+//
+#define AMANZI_DUAL_COMPARISON_(OP)                           \
+  template <int N>                                            \
+  bool operator OP(const Dual<N>& a, const Dual<N>& b)        \
+  {                                                           \
+    return a.value() OP b.value();                            \
+  }                                                           \
+  template <int N>                                            \
+  bool operator OP(const Dual<N>& a, double b)                \
+  {                                                           \
+    return a.value() OP b;                                    \
+  }                                                           \
+  template <int N>                                            \
+  bool operator OP(double a, const Dual<N>& b)                \
+  {                                                           \
+    return a OP b.value();                                    \
+  }
+
+AMANZI_DUAL_COMPARISON_(<)
+AMANZI_DUAL_COMPARISON_(>)
+AMANZI_DUAL_COMPARISON_(<=)
+AMANZI_DUAL_COMPARISON_(>=)
+AMANZI_DUAL_COMPARISON_(==)
+AMANZI_DUAL_COMPARISON_(!=)
+#undef AMANZI_DUAL_COMPARISON_
+
+
+//
+// math functions
+//
+template <int N>
+Dual<N>
+exp(const Dual<N>& a)
+{
+  double f = std::exp(a.value());
+  return a.Chain(f, f);
+}
+
+template <int N>
+Dual<N>
+log(const Dual<N>& a)
+{
+  return a.Chain(std::log(a.value()), 1. / a.value());
+}
+
+template <int N>
+Dual<N>
+sqrt(const Dual<N>& a)
+{
+  double f = std::sqrt(a.value());
+  return a.Chain(f, 0.5 / f);
+}
+
+template <int N>
+Dual<N>
+pow(const Dual<N>& a, double b)
+{
+  return a.Chain(std::pow(a.value(), b), b * std::pow(a.value(), b - 1.));
+}
+
+template <int N>
+Dual<N>
+pow(double a, const Dual<N>& b)
+{
+  double f = std::pow(a, b.value());
+  return b.Chain(f, f * std::log(a));
+}
+
+// The log(a) term only enters through the derivatives of b, so that, as
+// for doubles, a <= 0 is fine with a constant exponent.
+template <int N>
+Dual<N>
+pow(const Dual<N>& a, const Dual<N>& b)
+{
+  bool b_const = true;
+  for (int j = 0; j != N; ++j) b_const &= b.d(j) == 0.;
+  if (b_const) return pow(a, b.value());
+
+  double f = std::pow(a.value(), b.value());
+  return a.Chain(f, b.value() * std::pow(a.value(), b.value() - 1.)) +
+         b.Chain(0., f * std::log(a.value()));
+}
+
+template <int N>
+Dual<N>
+fabs(const Dual<N>& a)
+{
+  return a.value() < 0. ? -a : a;
+}
+
+template <int N>
+Dual<N>
+abs(const Dual<N>& a)
+{
+  return fabs(a);
+}
+
+template <int N>
+Dual<N>
+tanh(const Dual<N>& a)
+{
+  double f = std::tanh(a.value());
+  return a.Chain(f, 1. - f * f);
+}
+
+} // namespace Amanzi
@@ -15,6 +15,7 @@ parent entities.
 */
 
 #include "ExtractionEvaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -40,6 +41,7 @@ ExtractionEvaluator::Clone() const
 void
 ExtractionEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   auto& parent_vector = S.Get<CompositeVector>(dependency_key_, tag);
 
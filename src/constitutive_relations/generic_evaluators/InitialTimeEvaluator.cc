@@ -9,6 +9,7 @@
 
 #include "InitialTimeEvaluator.hh"
 #include "Units.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -62,6 +63,7 @@ InitialTimeEvaluator::Clone() const
 void
 InitialTimeEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   auto dep = dependencies_.front();
   if (S.get_time(tag) == time_ && !evaluated_once_) {
@@ -8,6 +8,7 @@
 */
 
 #include "MultiplicativeEvaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -54,6 +55,7 @@ MultiplicativeEvaluator::Clone() const
 void
 MultiplicativeEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   AMANZI_ASSERT(dependencies_.size() >= 1);
   result[0]->PutScalar(coef_);
 
@@ -83,6 +85,7 @@ MultiplicativeEvaluator::EvaluatePartialDerivative_(const State& S,
                                                     const Tag& wrt_tag,
                                                     const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   result[0]->PutScalar(coef_);
 
   for (const auto& lcv_name : *result[0]) {
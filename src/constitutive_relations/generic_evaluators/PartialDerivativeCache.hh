@@ -0,0 +1,89 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*!
+
+Partial derivatives of a secondary evaluator's result with respect to each of
+its dependencies, computed in the same sweep over entities as the value.
+
+An evaluator with many dependencies otherwise evaluates each partial
+derivative in its own sweep, reading every dependency each time.  With this
+cache, the first request of a partial derivative is computed as usual and
+kept; from then on it is also computed, and stored here, by every evaluation
+of the value, so that later requests are a copy.  Stored derivatives are
+current only until the next evaluation of the value.
+
+Copies of a cache are empty, so that cloned evaluators do not share one.
+
+*/
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "dbc.hh"
+#include "CompositeVector.hh"
+
+namespace Amanzi {
+
+class PartialDerivativeCache {
+ public:
+  explicit PartialDerivativeCache(int n_deps) : derivs_(n_deps), current_(n_deps, false) {}
+  PartialDerivativeCache(const PartialDerivativeCache& other)
+    : PartialDerivativeCache(other.derivs_.size())
+  {}
+  PartialDerivativeCache& operator=(const PartialDerivativeCache& other) = delete;
+
+  // Is the derivative with respect to dependency i current?
+  bool Has(int i) const { return current_[i]; }
+  const CompositeVector& Get(int i) const
+  {
+    AMANZI_ASSERT(current_[i]);
+    return *derivs_[i];
+  }
+
+  // Stores a derivative computed outside of an evaluation of the value, and
+  // computes it with the value from now on.
+  void Set(int i, const CompositeVector& deriv)
+  {
+    if (derivs_[i] == Teuchos::null) derivs_[i] = Teuchos::rcp(new CompositeVector(deriv.Map()));
+    *derivs_[i] = deriv;
+    current_[i] = true;
+  }
+
+  // Are no derivatives computed with the value?
+  bool Empty() const
+  {
+    for (const auto& deriv : derivs_)
+      if (deriv != Teuchos::null) return false;
+    return true;
+  }
+
+  // To be called before evaluating the value.  Owned values of component
+  // comp of the derivative with respect to dependency i, or null if it is
+  // not computed with the value.
+  void Invalidate() { current_.assign(current_.size(), false); }
+  double* View(int i, const std::string& comp)
+  {
+    return derivs_[i] == Teuchos::null ? nullptr : (*derivs_[i]->ViewComponent(comp, false))[0];
+  }
+
+  // To be called after evaluating the value and all views.
+  void Validate()
+  {
+    for (int i = 0; i != derivs_.size(); ++i) current_[i] = derivs_[i] != Teuchos::null;
+  }
+
+ private:
+  std::vector<Teuchos::RCP<CompositeVector>> derivs_;
+  std::vector<bool> current_;
+};
+
+} // namespace Amanzi
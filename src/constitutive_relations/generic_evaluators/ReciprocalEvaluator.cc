@@ -13,6 +13,7 @@
 */
 
 #include "ReciprocalEvaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -50,6 +51,7 @@ ReciprocalEvaluator::Clone() const
 void
 ReciprocalEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   AMANZI_ASSERT(dependencies_.size() == 2);
 
   auto key_tag_numer = dependencies_.begin();
@@ -83,6 +85,7 @@ ReciprocalEvaluator::EvaluatePartialDerivative_(const State& S,
                                                 const Tag& wrt_tag,
                                                 const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(dependencies_.size() == 2);
 
   auto key_tag_numer = dependencies_.begin();
@@ -9,6 +9,7 @@
 
 //! SubgridAggregateEvaluator restricts a field to the subgrid version of the same field.
 #include "SubgridAggregateEvaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -36,6 +37,7 @@ SubgridAggregateEvaluator::Clone() const
 void
 SubgridAggregateEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto ds = S.GetDomainSet(source_domain_);
   Epetra_MultiVector& result_v = *result[0]->ViewComponent("cell", false);
 
@@ -55,6 +57,7 @@ SubgridAggregateEvaluator::EvaluatePartialDerivative_(const State& S,
                                                       const Tag& wrt_tag,
                                                       const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   result[0]->PutScalar(1.);
 }
 
@@ -9,6 +9,7 @@
 
 //! SubgridDisaggregateEvaluator restricts a field to the subgrid version of the same field.
 #include "SubgridDisaggregateEvaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -37,6 +38,7 @@ SubgridDisaggregateEvaluator::Clone() const
 void
 SubgridDisaggregateEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   auto ds = S.GetDomainSet(domain_set_);
   ds->doExport(domain_index_,
@@ -51,6 +53,7 @@ SubgridDisaggregateEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   result[0]->PutScalar(1.);
 }
 
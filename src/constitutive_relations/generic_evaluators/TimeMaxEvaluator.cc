@@ -8,6 +8,7 @@
 */
 
 #include "TimeMaxEvaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -42,6 +43,7 @@ TimeMaxEvaluator::Clone() const
 void
 TimeMaxEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   if (!evaluated_once_) {
     if (operator_ == "max") {
       result[0]->PutScalar(-1.e16);
@@ -14,6 +14,7 @@
 */
 
 #include "overland_source_from_subsurface_flux_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -105,6 +106,7 @@ void
 OverlandSourceFromSubsurfaceFluxEvaluator::Evaluate_(const State& S,
                                                      const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   if (face_and_dirs_ == Teuchos::null) { IdentifyFaceAndDirection_(S); }
   auto tag = my_keys_.front().second;
 
@@ -143,6 +145,7 @@ OverlandSourceFromSubsurfaceFluxEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(0);
   // this would require differentiating flux wrt pressure, which we
   // don't do for now.
@@ -14,6 +14,7 @@
 */
 
 #include "surface_top_cells_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -42,6 +43,7 @@ SurfaceTopCellsEvaluator::Clone() const
 void
 SurfaceTopCellsEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> sub_vector = S.GetPtr<CompositeVector>(dependency_key_, tag);
   const Epetra_MultiVector& sub_vector_cells = *sub_vector->ViewComponent("cell", false);
@@ -14,6 +14,7 @@
 */
 
 #include "top_cells_surface_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -42,6 +43,7 @@ TopCellsSurfaceEvaluator::Clone() const
 void
 TopCellsSurfaceEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   auto surf_vector = S.GetPtr<CompositeVector>(dependency_key_, tag);
   const Epetra_MultiVector& surf_vector_cells = *surf_vector->ViewComponent("cell", false);
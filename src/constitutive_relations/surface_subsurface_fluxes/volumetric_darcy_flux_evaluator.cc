@@ -13,6 +13,7 @@
 */
 
 #include "volumetric_darcy_flux_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -56,6 +57,7 @@ Volumetric_FluxEvaluator::EnsureCompatibility_ToDeps_(State& S)
 void
 Volumetric_FluxEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   const Epetra_MultiVector& darcy_flux =
     *S.Get<CompositeVector>(flux_key_, tag).ViewComponent("face", false);
@@ -85,6 +87,7 @@ Volumetric_FluxEvaluator::EvaluatePartialDerivative_(const State& S,
                                                      const Tag& wrt_tag,
                                                      const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(0);
   // this would require differentiating flux wrt pressure, which we
   // don't do for now.
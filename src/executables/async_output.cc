@@ -0,0 +1,269 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/* -------------------------------------------------------------------------
+ATS
+
+Background writer of vis and checkpoint files.
+------------------------------------------------------------------------- */
+
+#include <map>
+
+#include "mpi.h"
+
+#include "Epetra_MpiComm.h"
+#include "Teuchos_ParameterList.hpp"
+
+#include "dbc.hh"
+#include "CompositeVector.hh"
+#include "State.hh"
+
+#include "async_output.hh"
+
+namespace ATS {
+
+namespace {
+
+// Frees the duplicated communicator with its Epetra wrapper.
+struct FreeComm {
+  typedef Epetra_MpiComm ptr_t;
+  void free(Epetra_MpiComm* comm)
+  {
+    MPI_Comm mpi_comm = comm->Comm();
+    delete comm;
+
+    int finalized;
+    MPI_Finalized(&finalized);
+    if (!finalized) MPI_Comm_free(&mpi_comm);
+  }
+};
+
+} // namespace
+
+
+AsyncOutput::AsyncOutput(int queue_size, const Teuchos::RCP<const Amanzi::State>& S_writer)
+  : S_writer_(S_writer), stages_(queue_size), stage_busy_(queue_size, false), done_(false)
+{
+  AMANZI_ASSERT(queue_size > 0);
+  AMANZI_ASSERT(S_writer_ != Teuchos::null);
+  thread_ = std::thread(&AsyncOutput::Run_, this);
+}
+
+
+AsyncOutput::~AsyncOutput()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    done_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+}
+
+
+void
+AsyncOutput::Write(const Amanzi::State& S, const std::vector<WriteFunc>& writes)
+{
+  if (writes.empty()) return;
+
+  // claim a free staging State, waiting for a write to finish if none is
+  int stage = -1;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] {
+      for (int i = 0; i != stage_busy_.size(); ++i) {
+        if (!stage_busy_[i]) {
+          stage = i;
+          return true;
+        }
+      }
+      return error_ != nullptr;
+    });
+    RethrowError_();
+    stage_busy_[stage] = true;
+  }
+
+  // the snapshot is taken by this thread, while the writer works on other
+  // stages
+  if (stages_[stage] == Teuchos::null) {
+    Teuchos::ParameterList state_list("state");
+    stages_[stage] = Teuchos::rcp(new Amanzi::State(state_list));
+  }
+  Snapshot_(S, *stages_[stage]);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(Job{ stage, writes });
+  }
+  cv_.notify_all();
+}
+
+
+bool
+AsyncOutput::Wait(bool rethrow)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] {
+    if (!jobs_.empty()) return false;
+    for (bool busy : stage_busy_)
+      if (busy) return false;
+    return true;
+  });
+
+  if (rethrow) {
+    RethrowError_();
+  } else if (error_) {
+    error_ = nullptr;
+    return false;
+  }
+  return true;
+}
+
+
+Amanzi::Comm_ptr_type
+AsyncOutput::DuplicateComm(const Amanzi::Comm_ptr_type& comm)
+{
+  MPI_Comm dup;
+  MPI_Comm_dup(comm->Comm(), &dup);
+  return Teuchos::rcpWithDealloc(new Epetra_MpiComm(dup), FreeComm(), true);
+}
+
+
+bool
+AsyncOutput::IsSupported(const Amanzi::State& S)
+{
+  int provided;
+  MPI_Query_thread(&provided);
+  if (provided != MPI_THREAD_MULTIPLE) return false;
+
+  for (auto mesh = S.mesh_begin(); mesh != S.mesh_end(); ++mesh) {
+    if (S.IsDeformableMesh(mesh->first)) return false;
+  }
+  return true;
+}
+
+
+// Copies the CompositeVector records of S that are written to vis or
+// checkpoint files, and all double and int records, which include time and
+// cycle, into stage.  The records of stage are created the first time, on
+// the meshes of the writer State.  Vectors are copied by component, as
+// their maps differ only in the communicator.
+void
+AsyncOutput::Snapshot_(const Amanzi::State& S, Amanzi::State& stage)
+{
+  if (stage.mesh_begin() == stage.mesh_end()) {
+    for (auto mesh = S_writer_->mesh_begin(); mesh != S_writer_->mesh_end(); ++mesh) {
+      stage.RegisterMesh(mesh->first, mesh->second.first, false);
+    }
+
+    // names of the meshes of S, to find the writer's mesh of each vector
+    std::map<const Amanzi::AmanziMesh::Mesh*, Amanzi::Key> mesh_names;
+    for (auto mesh = S.mesh_begin(); mesh != S.mesh_end(); ++mesh) {
+      mesh_names.emplace(mesh->second.first.get(), mesh->first);
+    }
+
+    for (auto rs = S.data_begin(); rs != S.data_end(); ++rs) {
+      const Amanzi::Key& key = rs->first;
+      for (const auto& entry : *rs->second) {
+        const Amanzi::Tag& tag = entry.first;
+        const Amanzi::Record& record = *entry.second;
+        if (record.ValidType<Amanzi::CompositeVector>()) {
+          if (!record.io_vis() && !record.io_checkpoint()) continue;
+
+          const auto& map = record.Get<Amanzi::CompositeVector>().Map();
+          auto mesh_name = mesh_names.find(map.Mesh().get());
+          if (mesh_name == mesh_names.end()) continue;
+
+          auto& space =
+            stage.Require<Amanzi::CompositeVector, Amanzi::CompositeVectorSpace>(key, tag, key);
+          space.SetMesh(S_writer_->GetMesh(mesh_name->second))->SetGhosted(map.Ghosted());
+          for (const auto& name : map) {
+            space.AddComponent(name, map.Location(name), map.NumVectors(name));
+          }
+        } else if (record.ValidType<double>()) {
+          stage.Require<double>(key, tag, key);
+        } else if (record.ValidType<int>()) {
+          stage.Require<int>(key, tag, key);
+        } else {
+          continue;
+        }
+        stage.GetRecordW(key, tag, key).set_io_vis(record.io_vis());
+        stage.GetRecordW(key, tag, key).set_io_checkpoint(record.io_checkpoint());
+      }
+
+      if (stage.HasRecordSet(key) && rs->second->subfieldnames()) {
+        stage.GetRecordSetW(key).set_subfieldnames(*rs->second->subfieldnames());
+      }
+    }
+    stage.Setup();
+  }
+
+  for (auto rs = stage.data_begin(); rs != stage.data_end(); ++rs) {
+    const Amanzi::Key& key = rs->first;
+    for (const auto& entry : *rs->second) {
+      const Amanzi::Tag& tag = entry.first;
+      const Amanzi::Record& record = S.GetRecord(key, tag);
+      if (!record.initialized()) continue;
+
+      if (record.ValidType<Amanzi::CompositeVector>()) {
+        const auto& vec = record.Get<Amanzi::CompositeVector>();
+        auto& stage_vec = stage.GetW<Amanzi::CompositeVector>(key, tag, key);
+        for (const auto& name : vec) {
+          *stage_vec.ViewComponent(name, false) = *vec.ViewComponent(name, false);
+        }
+      } else if (record.ValidType<double>()) {
+        stage.Assign<double>(key, tag, key, record.Get<double>());
+      } else {
+        stage.Assign<int>(key, tag, key, record.Get<int>());
+      }
+      stage.GetRecordW(key, tag, key).set_initialized();
+    }
+  }
+}
+
+
+void
+AsyncOutput::Run_()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this] { return done_ || !jobs_.empty(); });
+    if (jobs_.empty()) return;
+
+    Job job = std::move(jobs_.front());
+    jobs_.pop_front();
+    lock.unlock();
+
+    std::exception_ptr error;
+    try {
+      for (const auto& write : job.writes) write(*stages_[job.stage]);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    if (error && !error_) error_ = error;
+    stage_busy_[job.stage] = false;
+    cv_.notify_all();
+  }
+}
+
+
+// Must be called with the mutex held.
+void
+AsyncOutput::RethrowError_()
+{
+  if (error_) {
+    std::exception_ptr error = error_;
+    error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace ATS
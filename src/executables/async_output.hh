@@ -0,0 +1,99 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Writes vis and checkpoint files in the background, overlapped with time stepping.
+/*!
+
+Output is written from a snapshot: the CompositeVector records of State that
+are written to vis or checkpoint files, and all double and int records, are
+copied into a staging State, and the writes are queued for a background
+thread, which runs them against the staging State while the next step
+proceeds.  The queue is bounded by the number of staging States; if all are
+still being written, taking a snapshot waits for the oldest.
+
+Writes run in the background thread in the order they were queued.  An
+exception thrown by a write is rethrown by the next call to Write() or Wait().
+
+Vis and checkpoint files are written collectively, so the writer must not
+share a communicator with the time step.  Staging States use the meshes of
+a separate writer State, created on a communicator from DuplicateComm(), and
+the writes must use vis and checkpoint objects created on those meshes.  This
+also requires MPI to support calls from multiple threads.
+
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+
+namespace Amanzi {
+class State;
+};
+
+namespace ATS {
+
+class AsyncOutput {
+ public:
+  using WriteFunc = std::function<void(const Amanzi::State&)>;
+
+  // S_writer holds the meshes, on a duplicated communicator, that staging
+  // States are built on.  Its meshes must be partitioned as those of the
+  // States written.
+  AsyncOutput(int queue_size, const Teuchos::RCP<const Amanzi::State>& S_writer);
+  ~AsyncOutput();
+
+  // Snapshots S and queues writes of the snapshot.
+  void Write(const Amanzi::State& S, const std::vector<WriteFunc>& writes);
+
+  // Waits for all queued writes to complete.  An error of a write is
+  // rethrown, or, if rethrow is false, discarded and reported by returning
+  // false, for callers that are already handling another error.
+  bool Wait(bool rethrow = true);
+
+  // Duplicates comm.  The duplicate is freed once the last reference to it
+  // is released.
+  static Amanzi::Comm_ptr_type DuplicateComm(const Amanzi::Comm_ptr_type& comm);
+
+  // Can output of S be written asynchronously?  Requires thread-safe MPI and
+  // fixed meshes, as meshes are shared with the snapshot.
+  static bool IsSupported(const Amanzi::State& S);
+
+ private:
+  void Snapshot_(const Amanzi::State& S, Amanzi::State& stage);
+  void Run_();
+  void RethrowError_();
+
+  struct Job {
+    int stage;
+    std::vector<WriteFunc> writes;
+  };
+
+  Teuchos::RCP<const Amanzi::State> S_writer_;
+  std::vector<Teuchos::RCP<Amanzi::State>> stages_;
+  std::vector<bool> stage_busy_;
+  std::deque<Job> jobs_;
+  std::exception_ptr error_;
+  bool done_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread thread_;
+};
+
+} // namespace ATS
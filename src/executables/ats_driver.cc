@@ -40,6 +40,7 @@
 #include "exceptions.hh"
 #include "errors.hh"
 
+#include "async_output.hh"
 #include "ats_driver.hh"
 
 // won't run if DEBUG_MODE == false
@@ -163,6 +164,12 @@ ATSDriver::cycle_driver()
 
 #if !DEBUG_MODE
     } catch (Errors::TimeStepCrash& e) {
+      // errors of background writes must not replace the crash being reported
+      if (async_output_ != Teuchos::null && !async_output_->Wait(false) &&
+          vo_->os_OK(Teuchos::VERB_LOW)) {
+        *vo_->os() << "WARNING: asynchronous output failed before the crash." << std::endl;
+      }
+
       // write one more vis for help debugging
       S_->advance_cycle(Amanzi::Tags::NEXT);
       visualize(true); // force vis
@@ -171,6 +178,10 @@ ATSDriver::cycle_driver()
       for (const auto& obs : observations_) obs->Flush();
 
       // dump a post_mortem checkpoint file for debugging
+      if (async_output_ != Teuchos::null && !async_output_->Wait(false) &&
+          vo_->os_OK(Teuchos::VERB_LOW)) {
+        *vo_->os() << "WARNING: asynchronous vis of the crash failed." << std::endl;
+      }
       checkpoint_->set_filebasename("post_mortem");
       checkpoint_->Write(*S_, Amanzi::Checkpoint::WriteType::POST_MORTEM);
       throw e;
@@ -62,6 +62,25 @@ simulation, including starting and ending times and restart options.
       specifies a path to the checkpoint file to continue a stopped simulation.
     * `"wallclock duration [hrs]`" ``[double]`` **optional** After this time, the
       simulation will checkpoint and end.
+    * `"asynchronous output`" ``[bool]`` **false** If true, vis and checkpoint
+      files are written by a background thread from a snapshot of State, while
+      the next step proceeds.  Requires no deformable meshes and an MPI that
+      provides MPI_THREAD_MULTIPLE, which `ats` requests at startup; otherwise
+      output is synchronous.  As HDF5 is typically not thread-safe, nothing
+      else may use HDF5 while stepping, e.g. functions read from HDF5 files.
+      Vis and checkpoint files take their communicator from the mesh, so the
+      writer uses its own copy of the meshes, on a duplicate of the
+      communicator, which doubles the memory used by meshes.
+    * `"asynchronous output queue size`" ``[int]`` **1** Number of snapshots
+      that may be waiting to be written before taking another waits.
+    * `"profile`" ``[bool]`` **false** If true, time and count calls to each
+      PK's FunctionalResidual, UpdatePreconditioner, and ApplyPreconditioner,
+      and each evaluator's Evaluate_ and EvaluatePartialDerivative_, and report
+      the min/mean/max over ranks at the end of the run.  Times are inclusive:
+      a PK's time includes that of its sub-PKs and of the evaluators it updates.
+    * `"profile filename`" ``[string]`` **optional** If provided, the profile
+      is also written to this file, as JSON if the name ends in `".json`", and
+      as CSV otherwise.
     * `"required times`" ``[io-event-spec]`` **optional** An IOEvent_ spec that
       sets a collection of times/cycles at which the simulation is guaranteed to
       hit exactly.  This is useful for situations such as where data is provided at
@@ -19,9 +19,12 @@ only one PK -- most likely this PK is an MPC of some type -- to do the
 actual work.
 ------------------------------------------------------------------------- */
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <unistd.h>
 #include <sys/resource.h>
+#include "dbc.hh"
 #include "errors.hh"
 
 #include "Teuchos_ParameterList.hpp"
@@ -50,8 +53,11 @@ actual work.
 #include "TreeVector.hh"
 #include "PK_Factory.hh"
 #include "pk_helpers.hh"
+#include "ProfileTimer.hh"
 
 #include "ats_mesh_factory.hh"
+#include "async_output.hh"
+#include "state_memory.hh"
 
 #include "coordinator.hh"
 
@@ -84,6 +90,7 @@ Coordinator::Coordinator(const Teuchos::RCP<Teuchos::ParameterList>& plist,
   timers_["4c: observe"] = Teuchos::TimeMonitor::getNewCounter("4c: observe");
   timers_["4d: checkpoint"] = Teuchos::TimeMonitor::getNewCounter("4d: checkpoint");
   timers_["5: finalize"] = Teuchos::TimeMonitor::getNewCounter("5: finalize");
+  Amanzi::Profiling::enable(coordinator_list_->get<bool>("profile", false));
 
   // print header material
   if (vo_->os_OK(Teuchos::VERB_LOW)) {
@@ -182,64 +189,40 @@ Coordinator::Coordinator(const Teuchos::RCP<Teuchos::ParameterList>& plist,
       }
     }
 
-    // create visualization
-    auto vis_list = Teuchos::sublist(plist_, "visualization");
-    for (auto& entry : *vis_list) {
-      std::string domain_name = entry.first;
-
-      if (S_->HasMesh(domain_name)) {
-        // visualize standard domain
-        auto mesh_p = S_->GetMesh(domain_name);
-        auto sublist_p = Teuchos::sublist(vis_list, domain_name);
-        if (!sublist_p->isParameter("file name base")) {
-          if (domain_name.empty() || domain_name == "domain") {
-            sublist_p->set<std::string>("file name base", std::string("ats_vis"));
-          } else {
-            sublist_p->set<std::string>("file name base", std::string("ats_vis_") + domain_name);
-          }
-        }
-
-        if (S_->HasMesh(domain_name + "_3d") && sublist_p->get<bool>("visualize on 3D mesh", true))
-          mesh_p = S_->GetMesh(domain_name + "_3d");
-
-        // vis successful timesteps
-        auto vis = Teuchos::rcp(new Amanzi::Visualization(*sublist_p));
-        vis->set_name(domain_name);
-        vis->set_mesh(mesh_p);
-        vis->CreateFiles(false);
-        visualization_.push_back(vis);
-
-      } else if (Amanzi::Keys::isDomainSet(domain_name)) {
-        // visualize domain set
-        const auto& dset = S_->GetDomainSet(Amanzi::Keys::getDomainSetName(domain_name));
-        auto sublist_p = Teuchos::sublist(vis_list, domain_name);
-
-        if (sublist_p->get("visualize individually", false)) {
-          // visualize each subdomain
-          for (const auto& subdomain : *dset) {
-            Teuchos::ParameterList sublist = vis_list->sublist(subdomain);
-            sublist.set<std::string>("file name base", std::string("ats_vis_") + subdomain);
-            auto vis = Teuchos::rcp(new Amanzi::Visualization(sublist));
-            vis->set_name(subdomain);
-            vis->set_mesh(S_->GetMesh(subdomain));
-            vis->CreateFiles(false);
-            visualization_.push_back(vis);
-          }
-        } else {
-          // visualize collectively
-          auto domain_name_base = Amanzi::Keys::getDomainSetName(domain_name);
-          if (!sublist_p->isParameter("file name base"))
-            sublist_p->set("file name base", std::string("ats_vis_") + domain_name_base);
-          auto vis = Teuchos::rcp(new Amanzi::VisualizationDomainSet(*sublist_p));
-          vis->set_name(domain_name_base);
-          vis->set_domain_set(dset);
-          vis->set_mesh(dset->getReferencingParent());
-          vis->CreateFiles(false);
-          visualization_.push_back(vis);
-        }
+    // write vis and checkpoint files in the background, if possible
+    bool async_output = false;
+    if (coordinator_list_->get<bool>("asynchronous output", false)) {
+      if (AsyncOutput::IsSupported(*S_)) {
+        async_output = true;
+      } else if (vo_->os_OK(Teuchos::VERB_LOW)) {
+        *vo_->os() << "WARNING: asynchronous output requires MPI_THREAD_MULTIPLE and no "
+                   << "deformable meshes; writing output synchronously." << std::endl;
       }
     }
 
+    // create visualization; with asynchronous output, these only schedule
+    // output and files are written by the writer's copies
+    visualization_ = createVisualization_(*S_, !async_output);
+
+    if (async_output) {
+      // The writer's collective calls must not interleave with those of the
+      // time step, so it writes through its own copy of the meshes, on a
+      // duplicate of the communicator.
+      Teuchos::TimeMonitor timer(*timers_.at("0: create mesh"));
+      auto writer_comm = AsyncOutput::DuplicateComm(comm_);
+      S_writer_ = Teuchos::rcp(new Amanzi::State(plist_->sublist("state")));
+      Teuchos::ParameterList reg_list = plist_->sublist("regions");
+      Teuchos::RCP<Amanzi::AmanziGeometry::GeometricModel> gm =
+        Teuchos::rcp(new Amanzi::AmanziGeometry::GeometricModel(3, reg_list, *writer_comm));
+      ATS::Mesh::createMeshes(plist_, writer_comm, gm, *S_writer_);
+
+      writer_visualization_ = createVisualization_(*S_writer_, true);
+      writer_checkpoint_ = Teuchos::rcp(new Amanzi::Checkpoint(chkp_plist, *S_writer_));
+
+      int queue_size = coordinator_list_->get<int>("asynchronous output queue size", 1);
+      async_output_ = Teuchos::rcp(new AsyncOutput(queue_size, S_writer_));
+    }
+
     // create the time step manager, register assorted timestep control events
     tsm_ = Teuchos::rcp(new Amanzi::TimeStepManager());
     checkpoint_->RegisterWithTimeStepManager(tsm_.ptr());
@@ -279,6 +262,9 @@ Coordinator::setup()
   pk_->Setup();
   for (auto& obs : observations_) obs->Setup(S_.ptr());
   S_->Setup();
+
+  // all memory of State is now allocated
+  WriteStateMemory(*S_, *comm_, *vo_);
 }
 
 void
@@ -361,6 +347,7 @@ void
 Coordinator::finalize()
 {
   Teuchos::TimeMonitor monitor(*timers_.at("5: finalize"));
+  if (async_output_ != Teuchos::null) async_output_->Wait();
 
   // Force checkpoint at the end of simulation, and copy to checkpoint_final
   pk_->CalculateDiagnostics(Amanzi::Tags::NEXT);
@@ -372,6 +359,8 @@ Coordinator::finalize()
   // report out
   WriteStateStatistics(*S_, *vo_);
   report_memory();
+  WriteStateMemory(*S_, *comm_, *vo_);
+  if (Amanzi::Profiling::enabled()) reportProfile_();
 }
 
 
@@ -441,26 +430,6 @@ Coordinator::report_memory()
                << total_mem / global_ncells * 1024 * 1024 << " Bytes" << std::endl;
   }
 
-
-  // double doubles_count(0.0);
-  // for (Amanzi::State::data_iterator field=S_->data_begin(); field!=S_->data_end(); ++field) {
-  //   doubles_count += static_cast<double>(field->second->GetLocalElementCount());
-  // }
-  // double global_doubles_count(0.0);
-  // double min_doubles_count(0.0);
-  // double max_doubles_count(0.0);
-  // comm_->SumAll(&doubles_count,&global_doubles_count,1);
-  // comm_->MinAll(&doubles_count,&min_doubles_count,1);
-  // comm_->MaxAll(&doubles_count,&max_doubles_count,1);
-
-  // Teuchos::OSTab tab = vo_->getOSTab();
-  // *vo_->os() << "Doubles allocated in state fields " << std::endl;
-  // *vo_->os() << "  Maximum per core:   " << std::setw(7)
-  //            << max_doubles_count*8/1024/1024 << " MBytes" << std::endl;
-  // *vo_->os() << "  Minimum per core:   " << std::setw(7)
-  //            << min_doubles_count*8/1024/1024 << " MBytes" << std::endl;
-  // *vo_->os() << "  Total:              " << std::setw(7)
-  //            << global_doubles_count*8/1024/1024 << " MBytes" << std::endl;
 }
 
 
@@ -553,7 +522,9 @@ Coordinator::advance()
 
   } else {
     // Failed the timestep.
-    // Potentially write out failed timestep for debugging
+    // Potentially write out failed timestep for debugging.  These are on the
+    // meshes of S_, so are written here once background writes are done.
+    if (!failed_visualization_.empty() && async_output_ != Teuchos::null) async_output_->Wait();
     for (const auto& vis : failed_visualization_) WriteVis(*vis, *S_);
 
     // copy from old time into new time to reset the timestep
@@ -607,9 +578,20 @@ Coordinator::visualize(bool force)
 
   if (dump) { pk_->CalculateDiagnostics(Amanzi::Tags::NEXT); }
 
-  for (const auto& vis : visualization_) {
-    if (force || vis->DumpRequested(cycle, time)) { WriteVis(*vis, *S_); }
+  // with asynchronous output, this times only the snapshot and any wait for
+  // a previous write
+  std::vector<AsyncOutput::WriteFunc> writes;
+  for (int i = 0; i != visualization_.size(); ++i) {
+    if (force || visualization_[i]->DumpRequested(cycle, time)) {
+      if (async_output_ != Teuchos::null) {
+        auto vis = writer_visualization_[i];
+        writes.push_back([vis](const Amanzi::State& S) { WriteVis(*vis, S); });
+      } else {
+        WriteVis(*visualization_[i], *S_);
+      }
+    }
   }
+  if (async_output_ != Teuchos::null) async_output_->Write(*S_, writes);
   return dump;
 }
 
@@ -630,10 +612,82 @@ Coordinator::checkpoint(bool force)
   double time = S_->get_time();
   bool dump = force;
   dump |= checkpoint_->DumpRequested(cycle, time);
-  if (dump) checkpoint_->Write(*S_);
+  if (dump) {
+    if (async_output_ != Teuchos::null) {
+      auto chkp = writer_checkpoint_;
+      async_output_->Write(*S_, { [chkp](const Amanzi::State& S) { chkp->Write(S); } });
+    } else {
+      checkpoint_->Write(*S_);
+    }
+  }
   return dump;
 }
 
+// Creates the vis objects of the "visualization" list on the meshes of S.
+std::vector<Teuchos::RCP<Amanzi::Visualization>>
+Coordinator::createVisualization_(const Amanzi::State& S, bool create_files)
+{
+  std::vector<Teuchos::RCP<Amanzi::Visualization>> visualization;
+  auto vis_list = Teuchos::sublist(plist_, "visualization");
+  for (auto& entry : *vis_list) {
+    std::string domain_name = entry.first;
+
+    if (S.HasMesh(domain_name)) {
+      // visualize standard domain
+      auto mesh_p = S.GetMesh(domain_name);
+      auto sublist_p = Teuchos::sublist(vis_list, domain_name);
+      if (!sublist_p->isParameter("file name base")) {
+        if (domain_name.empty() || domain_name == "domain") {
+          sublist_p->set<std::string>("file name base", std::string("ats_vis"));
+        } else {
+          sublist_p->set<std::string>("file name base", std::string("ats_vis_") + domain_name);
+        }
+      }
+
+      if (S.HasMesh(domain_name + "_3d") && sublist_p->get<bool>("visualize on 3D mesh", true))
+        mesh_p = S.GetMesh(domain_name + "_3d");
+
+      // vis successful timesteps
+      auto vis = Teuchos::rcp(new Amanzi::Visualization(*sublist_p));
+      vis->set_name(domain_name);
+      vis->set_mesh(mesh_p);
+      if (create_files) vis->CreateFiles(false);
+      visualization.push_back(vis);
+
+    } else if (Amanzi::Keys::isDomainSet(domain_name)) {
+      // visualize domain set
+      const auto& dset = S.GetDomainSet(Amanzi::Keys::getDomainSetName(domain_name));
+      auto sublist_p = Teuchos::sublist(vis_list, domain_name);
+
+      if (sublist_p->get("visualize individually", false)) {
+        // visualize each subdomain
+        for (const auto& subdomain : *dset) {
+          Teuchos::ParameterList sublist = vis_list->sublist(subdomain);
+          sublist.set<std::string>("file name base", std::string("ats_vis_") + subdomain);
+          auto vis = Teuchos::rcp(new Amanzi::Visualization(sublist));
+          vis->set_name(subdomain);
+          vis->set_mesh(S.GetMesh(subdomain));
+          if (create_files) vis->CreateFiles(false);
+          visualization.push_back(vis);
+        }
+      } else {
+        // visualize collectively
+        auto domain_name_base = Amanzi::Keys::getDomainSetName(domain_name);
+        if (!sublist_p->isParameter("file name base"))
+          sublist_p->set("file name base", std::string("ats_vis_") + domain_name_base);
+        auto vis = Teuchos::rcp(new Amanzi::VisualizationDomainSet(*sublist_p));
+        vis->set_name(domain_name_base);
+        vis->set_domain_set(dset);
+        vis->set_mesh(dset->getReferencingParent());
+        if (create_files) vis->CreateFiles(false);
+        visualization.push_back(vis);
+      }
+    }
+  }
+  return visualization;
+}
+
+
 void
 Coordinator::reportOneTimer_(const std::string& timer_name)
 {
@@ -650,4 +704,92 @@ Coordinator::reportOneTimer_(const std::string& timer_name)
   }
 }
 
+
+// Reports the profiling timers, grouped by PK or evaluator, as min / mean /
+// max over ranks, and optionally writes them to a file.
+void
+Coordinator::reportProfile_()
+{
+  // labels are "profile: CATEGORY: NAME: METHOD", and ranks may have
+  // different sets of timers, e.g. for column PKs
+  Teuchos::stat_map_type stats;
+  std::vector<std::string> stat_names;
+  Teuchos::TimeMonitor::computeGlobalTimerStatistics(
+    stats, stat_names, teuchos_comm_.ptr(), Teuchos::Union, Amanzi::Profiling::prefix());
+
+  auto index = [&stat_names](const std::string& stat_name) {
+    auto it = std::find(stat_names.begin(), stat_names.end(), stat_name);
+    AMANZI_ASSERT(it != stat_names.end());
+    return it - stat_names.begin();
+  };
+  int i_min = index("MinOverProcs");
+  int i_mean = index("MeanOverProcs");
+  int i_max = index("MaxOverProcs");
+
+  struct Entry {
+    std::string category, name, method;
+    double min, mean, max, calls;
+  };
+  std::vector<Entry> entries;
+  for (const auto& stat : stats) {
+    std::string label = stat.first.substr(Amanzi::Profiling::prefix().size());
+    std::size_t first = label.find(": ");
+    std::size_t last = label.rfind(": ");
+    if (first == std::string::npos || first == last) continue;
+    entries.push_back(Entry{ label.substr(0, first),
+                             label.substr(first + 2, last - first - 2),
+                             label.substr(last + 2),
+                             stat.second[i_min].first,
+                             stat.second[i_mean].first,
+                             stat.second[i_max].first,
+                             stat.second[i_mean].second });
+  }
+
+  if (vo_->os_OK(Teuchos::VERB_LOW)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "Profile (min/mean/max) [s], mean number of calls:" << std::endl;
+    std::string group;
+    for (const auto& entry : entries) {
+      if (entry.category + ": " + entry.name != group) {
+        group = entry.category + ": " + entry.name;
+        *vo_->os() << "  " << group << std::endl;
+      }
+      *vo_->os() << "    " << entry.method << ": " << entry.min << " / " << entry.mean << " / "
+                 << entry.max << ", " << entry.calls << std::endl;
+    }
+  }
+
+  std::string filename = coordinator_list_->get<std::string>("profile filename", "");
+  if (!filename.empty() && comm_->MyPID() == 0) {
+    std::ofstream file(filename);
+    if (!file) {
+      Errors::Message msg;
+      msg << "Coordinator: cannot open profile file \"" << filename << "\"";
+      Exceptions::amanzi_throw(msg);
+    }
+    file.precision(8);
+
+    bool json = filename.size() >= 5 && filename.compare(filename.size() - 5, 5, ".json") == 0;
+    if (json) {
+      file << "[" << std::endl;
+      for (std::size_t i = 0; i != entries.size(); ++i) {
+        const auto& entry = entries[i];
+        file << "  {\"category\": \"" << entry.category << "\", \"name\": \"" << entry.name
+             << "\", \"method\": \"" << entry.method << "\", \"min\": " << entry.min
+             << ", \"mean\": " << entry.mean << ", \"max\": " << entry.max
+             << ", \"calls\": " << entry.calls << "}" << (i + 1 == entries.size() ? "" : ",")
+             << std::endl;
+      }
+      file << "]" << std::endl;
+    } else {
+      file << "category,name,method,min [s],mean [s],max [s],calls" << std::endl;
+      for (const auto& entry : entries) {
+        file << entry.category << ",\"" << entry.name << "\"," << entry.method << ","
+             << entry.min << "," << entry.mean << "," << entry.max << "," << entry.calls
+             << std::endl;
+      }
+    }
+  }
+}
+
 } // namespace ATS
@@ -34,6 +34,8 @@ class UnstructuredObservations;
 
 namespace ATS {
 
+class AsyncOutput;
+
 class Coordinator {
  public:
   Coordinator(const Teuchos::RCP<Teuchos::ParameterList>& plist,
@@ -56,6 +58,9 @@ class Coordinator {
  protected:
   void initializeFromPlist_();
   void reportOneTimer_(const std::string& timer);
+  void reportProfile_();
+  std::vector<Teuchos::RCP<Amanzi::Visualization>>
+  createVisualization_(const Amanzi::State& S, bool create_files);
 
   // PK container and factory
   Teuchos::RCP<Amanzi::PK> pk_;
@@ -82,6 +87,13 @@ class Coordinator {
   std::vector<Teuchos::RCP<Amanzi::Visualization>> visualization_;
   std::vector<Teuchos::RCP<Amanzi::Visualization>> failed_visualization_;
   Teuchos::RCP<Amanzi::Checkpoint> checkpoint_;
+  Teuchos::RCP<AsyncOutput> async_output_; // null if output is synchronous
+
+  // meshes, vis and checkpointing used by asynchronous output
+  Teuchos::RCP<Amanzi::State> S_writer_;
+  std::vector<Teuchos::RCP<Amanzi::Visualization>> writer_visualization_;
+  Teuchos::RCP<Amanzi::Checkpoint> writer_checkpoint_;
+
   bool restart_;
   std::string restart_filename_;
 
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <filesystem>
 
+#include "mpi.h"
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_ParameterXMLFileReader.hpp"
 #include "Teuchos_XMLParameterListHelpers.hpp"
@@ -44,6 +45,12 @@ main(int argc, char* argv[])
   feraiseexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
 #endif
 
+  // Request MPI_THREAD_MULTIPLE, used by asynchronous output and parallel
+  // subdomains, before GlobalMPISession, which would otherwise call MPI_Init
+  // and so get the implementation's default thread level.  GlobalMPISession
+  // still finalizes MPI.
+  int mpi_thread_provided;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &mpi_thread_provided);
   Teuchos::GlobalMPISession mpiSession(&argc, &argv, 0);
   int rank = mpiSession.getRank();
   Kokkos::initialize();
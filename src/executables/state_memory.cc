@@ -0,0 +1,223 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/* -------------------------------------------------------------------------
+ATS
+
+Accounting of the memory held by State.
+------------------------------------------------------------------------- */
+
+#include <algorithm>
+#include <iomanip>
+#include <ios>
+#include <map>
+#include <vector>
+
+#include "Epetra_MultiVector.h"
+
+#include "CompositeVector.hh"
+#include "Mesh.hh"
+#include "State.hh"
+
+#include "state_memory.hh"
+
+namespace ATS {
+
+namespace {
+
+const double MB = 1024. * 1024.;
+
+// Adds the bytes of a vector, and of its ghost entries, to bytes and ghost.
+void
+addBytes(const Amanzi::CompositeVector& cv, double& bytes, double& ghost)
+{
+  for (const auto& comp : cv) {
+    const Epetra_MultiVector& owned = *cv.ViewComponent(comp, false);
+    double n_owned = static_cast<double>(owned.MyLength()) * owned.NumVectors();
+    double n = n_owned;
+    if (cv.Ghosted()) {
+      const Epetra_MultiVector& ghosted = *cv.ViewComponent(comp, true);
+      n = static_cast<double>(ghosted.MyLength()) * ghosted.NumVectors();
+    }
+    bytes += sizeof(double) * n;
+    ghost += sizeof(double) * (n - n_owned);
+  }
+}
+
+
+// Do two vectors hold the same owned values, on this rank?
+bool
+isIdentical(const Amanzi::CompositeVector& a, const Amanzi::CompositeVector& b)
+{
+  for (const auto& comp : a)
+    if (!b.HasComponent(comp)) return false;
+  for (const auto& comp : b)
+    if (!a.HasComponent(comp)) return false;
+
+  for (const auto& comp : a) {
+    const Epetra_MultiVector& a_v = *a.ViewComponent(comp, false);
+    const Epetra_MultiVector& b_v = *b.ViewComponent(comp, false);
+    if (a_v.MyLength() != b_v.MyLength() || a_v.NumVectors() != b_v.NumVectors()) return false;
+    for (int j = 0; j != a_v.NumVectors(); ++j) {
+      if (!std::equal(a_v[j], a_v[j] + a_v.MyLength(), b_v[j])) return false;
+    }
+  }
+  return true;
+}
+
+
+struct KeyMemory {
+  Amanzi::Key key;
+  double bytes = 0.;
+  double ghost = 0.;
+  double derivs = 0.;
+  std::vector<Amanzi::Tag> tags;
+};
+
+} // namespace
+
+
+void
+WriteStateMemory(const Amanzi::State& S,
+                 const Amanzi::Comm_type& comm,
+                 const Amanzi::VerboseObject& vo,
+                 const Teuchos::EVerbosityLevel vl)
+{
+  if (!vo.os_OK(vl)) return;
+
+  std::vector<KeyMemory> keys;
+  std::map<std::string, double> tags;
+  std::vector<std::string> aliased, identical;
+  double identical_bytes = 0.;
+
+  for (auto rs = S.data_begin(); rs != S.data_end(); ++rs) {
+    KeyMemory km;
+    km.key = rs->first;
+
+    // records at each tag, in which an alias shares the vector of its target
+    std::map<const Amanzi::CompositeVector*, Amanzi::Tag> owners;
+    for (const auto& entry : *rs->second) {
+      const Amanzi::Tag& tag = entry.first;
+      const Amanzi::Record& record = *entry.second;
+      if (!record.ValidType<Amanzi::CompositeVector>()) continue;
+
+      const auto& cv = record.Get<Amanzi::CompositeVector>();
+      auto owner = owners.find(&cv);
+      if (owner != owners.end()) {
+        aliased.push_back(Amanzi::Keys::getKey(km.key, tag) + " -> " +
+                          Amanzi::Keys::getKey(km.key, owner->second));
+        continue;
+      }
+
+      // check for a distinct copy that currently holds another tag's values,
+      // a candidate for aliasing; equal values need not mean it is redundant
+      for (const auto& other : owners) {
+        if (record.initialized() && S.GetRecord(km.key, other.second).initialized() &&
+            isIdentical(cv, *other.first)) {
+          double bytes = 0., ghost = 0.;
+          addBytes(cv, bytes, ghost);
+          identical_bytes += bytes;
+          identical.push_back(Amanzi::Keys::getKey(km.key, tag) + " == " +
+                               Amanzi::Keys::getKey(km.key, other.second));
+          break;
+        }
+      }
+      owners[&cv] = tag;
+
+      double bytes = 0.;
+      addBytes(cv, bytes, km.ghost);
+
+      // derivatives of this record, with respect to any key
+      if (S.HasDerivativeSet(km.key, tag)) {
+        for (const auto& deriv : S.GetDerivativeSet(km.key, tag)) {
+          if (deriv.second->ValidType<Amanzi::CompositeVector>()) {
+            addBytes(deriv.second->Get<Amanzi::CompositeVector>(), km.derivs, km.ghost);
+          }
+        }
+      }
+
+      km.bytes += bytes;
+      tags[tag.get()] += bytes;
+      km.tags.push_back(tag);
+    }
+
+    if (!km.tags.empty()) keys.push_back(km);
+  }
+
+  // totals, reduced over ranks
+  double local[4] = { 0., 0., 0., identical_bytes };
+  for (const auto& km : keys) {
+    local[0] += km.bytes + km.derivs;
+    local[1] += km.derivs;
+    local[2] += km.ghost;
+  }
+  double min[4], max[4], sum[4];
+  comm.MinAll(local, min, 4);
+  comm.MaxAll(local, max, 4);
+  comm.SumAll(local, sum, 4);
+
+  double local_ncells = 0.;
+  for (auto mesh = S.mesh_begin(); mesh != S.mesh_end(); ++mesh) {
+    local_ncells += mesh->second.first->getNumEntities(Amanzi::AmanziMesh::Entity_kind::CELL,
+                                                       Amanzi::AmanziMesh::Parallel_kind::OWNED);
+  }
+  double global_ncells = 0.;
+  comm.SumAll(&local_ncells, &global_ncells, 1);
+
+  // the format of the shared output stream is restored on exit
+  Teuchos::OSTab tab = vo.getOSTab();
+  std::ios_base::fmtflags os_flags = vo.os()->flags();
+  std::streamsize os_precision = vo.os()->precision();
+  int nprocs = comm.NumProc();
+  const char* labels[4] = { "Total:       ", "Derivatives: ", "Ghosts:      ", "Same values: " };
+  *vo.os() << "--------------------------------------------------------------------------------"
+           << std::endl
+           << "Memory held by State (min / mean / max per core):" << std::endl
+           << std::fixed << std::setprecision(1);
+  for (int i = 0; i != 4; ++i) {
+    *vo.os() << "  " << labels[i] << std::setw(8) << min[i] / MB << " / " << std::setw(8)
+             << sum[i] / nprocs / MB << " / " << std::setw(8) << max[i] / MB << " MBytes"
+             << std::endl;
+  }
+  if (global_ncells > 0) {
+    *vo.os() << "  Per cell:    " << std::setw(8) << sum[0] / global_ncells << " Bytes"
+             << std::endl;
+  }
+
+  if (vo.os_OK(Teuchos::VERB_HIGH)) {
+    *vo.os() << "State memory on this core, by tag (excluding derivatives):" << std::endl;
+    for (const auto& tag : tags) {
+      *vo.os() << "  " << std::left << std::setw(40) << "\"" + tag.first + "\"" << std::right
+               << std::setw(10) << tag.second / MB << " MBytes" << std::endl;
+    }
+
+    std::sort(keys.begin(), keys.end(), [](const KeyMemory& a, const KeyMemory& b) {
+      return a.bytes + a.derivs > b.bytes + b.derivs;
+    });
+    *vo.os() << "State memory on this core, by key (values + derivatives, ghosts included):"
+             << std::endl;
+    for (const auto& km : keys) {
+      *vo.os() << "  " << std::left << std::setw(40) << km.key << std::right << std::setw(10)
+               << km.bytes / MB << " + " << std::setw(8) << km.derivs / MB << " MBytes at";
+      for (const auto& tag : km.tags) *vo.os() << " \"" << tag.get() << "\"";
+      *vo.os() << std::endl;
+    }
+
+    *vo.os() << "Aliased records, stored once:" << (aliased.empty() ? " none" : "") << std::endl;
+    for (const auto& alias : aliased) *vo.os() << "  " << alias << std::endl;
+    *vo.os() << "Distinct records holding the same values, candidates for aliasing:"
+             << (identical.empty() ? " none" : "") << std::endl;
+    for (const auto& ident : identical) *vo.os() << "  " << ident << std::endl;
+  }
+
+  vo.os()->flags(os_flags);
+  vo.os()->precision(os_precision);
+}
+
+} // namespace ATS
@@ -0,0 +1,45 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Accounting of the memory held by State.
+/*!
+
+Walks every record of State, at every tag, along with the derivatives of each
+record, and sums the storage of CompositeVectors, including ghost entries.
+Records that alias another tag's record are counted once.  Records at
+different tags of the same key that are distinct but, at the time of the
+report, hold the same values are reported separately as "same values".  These
+are only candidates for aliasing: equal values, e.g. at the end of setup, need
+not mean that the copy is redundant.
+
+Totals are reported as min/mean/max over ranks.  At high verbosity, the
+breakdown by tag and by key, largest first, of the writing rank is reported.
+
+*/
+
+#pragma once
+
+#include "Teuchos_VerboseObject.hpp"
+
+#include "AmanziComm.hh"
+#include "VerboseObject.hh"
+
+namespace Amanzi {
+class State;
+};
+
+namespace ATS {
+
+void
+WriteStateMemory(const Amanzi::State& S,
+                 const Amanzi::Comm_type& comm,
+                 const Amanzi::VerboseObject& vo,
+                 const Teuchos::EVerbosityLevel vl = Teuchos::VERB_MEDIUM);
+
+} // namespace ATS
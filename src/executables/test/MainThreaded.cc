@@ -0,0 +1,33 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// As Main.cc, but requests MPI_THREAD_MULTIPLE for tests that call MPI from
+// host threads.
+
+#include <mpi.h>
+
+#include <TestReporterStdout.h>
+#include <UnitTest++.h>
+
+#include "ats_registration_files.hh"
+#include "VerboseObject_objs.hh"
+
+#include "Kokkos_Core.hpp"
+
+int
+main(int argc, char* argv[])
+{
+  int provided;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+  Kokkos::initialize(argc, argv);
+  auto result = UnitTest::RunAllTests();
+  Kokkos::finalize();
+  MPI_Finalize();
+  return result;
+}
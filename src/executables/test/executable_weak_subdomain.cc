@@ -0,0 +1,164 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Checks that advancing the subdomains of a weak subdomain MPC in parallel
+  gives the same result as advancing them serially.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "mpi.h"
+#include "AmanziComm.hh"
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_ParameterXMLFileReader.hpp"
+#include "Teuchos_XMLParameterListHelpers.hpp"
+#include "UnitTest++.h"
+
+// Amanzi
+#include "exceptions.hh"
+#include "Mesh.hh"
+#include "State.hh"
+
+#include "mpc_weak_subdomain.hh"
+#include "ats_mesh_factory.hh"
+
+using namespace Amanzi;
+
+struct WeakSubdomainProblem {
+ public:
+  Teuchos::RCP<Teuchos::ParameterList> plist;
+  Teuchos::RCP<State> S;
+  Teuchos::RCP<MPCWeakSubdomain> pk;
+  Teuchos::RCP<TreeVector> soln;
+  Comm_ptr_type comm;
+
+  WeakSubdomainProblem() {}
+
+  void init(bool parallel)
+  {
+    comm = getDefaultComm();
+    plist = Teuchos::getParametersFromXmlFile("test/executable_weak_subdomain.xml");
+    plist->sublist("PKs").sublist("columns").set("advance subdomains in parallel", parallel);
+
+    // create state and meshes
+    S = Teuchos::rcp(new State(plist->sublist("state")));
+    soln = Teuchos::rcp(new TreeVector(comm));
+
+    auto& regions_list = plist->sublist("regions");
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3, regions_list, *comm));
+    ATS::Mesh::createMeshes(plist, comm, gm, *S);
+
+    // create the PK
+    Teuchos::ParameterList pk_tree_list("PK tree");
+    pk_tree_list.sublist("columns").set("PK type", "domain set weak MPC");
+    pk_tree_list.sublist("columns").sublist("column:*-flow").set("PK type", "richards flow");
+
+    Amanzi::PKFactory pk_factory;
+    auto pk_as_pk = pk_factory.CreatePK("columns", pk_tree_list, plist, S, soln);
+    pk = Teuchos::rcp_dynamic_cast<MPCWeakSubdomain>(pk_as_pk);
+    AMANZI_ASSERT(pk.get());
+
+    // setup stage
+    S->Require<double>("atmospheric_pressure", Tags::DEFAULT, "coordinator");
+    S->Require<AmanziGeometry::Point>("gravity", Tags::DEFAULT, "coordinator");
+    S->require_time(Tags::CURRENT);
+    S->require_time(Tags::NEXT);
+
+    pk->set_tags(Tags::CURRENT, Tags::NEXT);
+    pk->Setup();
+    S->Setup();
+
+    // initialization stage
+    S->set_time(Tags::CURRENT, 0.);
+    S->set_time(Tags::NEXT, 0.);
+    S->set_cycle(0);
+    S->InitializeFields();
+    pk->Initialize();
+    S->InitializeEvaluators();
+    S->InitializeFieldCopies();
+    S->CheckAllFieldsInitialized();
+    pk->CommitStep(0., 0., Tags::NEXT);
+  }
+
+  // advance by the MPC's time step to t_end
+  void advance(double t_end)
+  {
+    double t = S->get_time(Tags::CURRENT);
+    while (t < t_end) {
+      double dt = pk->get_dt();
+      pk->set_dt(dt);
+      S->set_time(Tags::NEXT, t + dt);
+      bool fail = pk->AdvanceStep(t, t + dt, false);
+      CHECK(!fail);
+      pk->CommitStep(t, t + dt, Tags::NEXT);
+      t += dt;
+      S->set_time(Tags::CURRENT, t);
+      S->advance_cycle();
+    }
+  }
+
+  // pressure of each column at the end of its subcycling
+  std::vector<std::vector<double>> pressures()
+  {
+    std::vector<std::vector<double>> p;
+    for (const auto& subdomain : *S->GetDomainSet("column")) {
+      Tag tag(Keys::getKey(subdomain, "next"));
+      const auto& p_c =
+        *S->Get<CompositeVector>(Keys::getKey(subdomain, "pressure"), tag).ViewComponent("cell");
+      p.emplace_back(p_c[0], p_c[0] + p_c.MyLength());
+    }
+    return p;
+  }
+};
+
+
+SUITE(EXECUTABLE_WEAK_SUBDOMAIN)
+{
+  TEST(PARALLEL_MATCHES_SERIAL)
+  {
+    int provided;
+    MPI_Query_thread(&provided);
+    if (provided != MPI_THREAD_MULTIPLE) {
+      std::cout << "MPI_THREAD_MULTIPLE not provided, the parallel run is serial." << std::endl;
+    }
+
+    WeakSubdomainProblem serial;
+    serial.init(false);
+    auto p_init = serial.pressures();
+    serial.advance(4 * 3600.);
+
+    WeakSubdomainProblem parallel;
+    parallel.init(true);
+    parallel.advance(4 * 3600.);
+
+    auto p_serial = serial.pressures();
+    auto p_parallel = parallel.pressures();
+    CHECK(p_serial.size() > 0);
+    CHECK_EQUAL(p_serial.size(), p_parallel.size());
+    for (int i = 0; i != p_serial.size(); ++i) {
+      CHECK_EQUAL(p_serial[i].size(), p_parallel[i].size());
+      for (int c = 0; c != p_serial[i].size(); ++c) {
+        CHECK_CLOSE(p_serial[i][c], p_parallel[i][c], 1.e-10 * std::abs(p_serial[i][c]));
+      }
+    }
+
+    // the source must have changed the columns for this to be a test
+    double dp = 0.;
+    for (int c = 0; c != p_init[0].size(); ++c) {
+      dp = std::max(dp, std::abs(p_serial[0][c] - p_init[0][c]));
+    }
+    CHECK(dp > 1.);
+  }
+}
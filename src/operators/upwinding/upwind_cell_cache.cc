@@ -0,0 +1,120 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// Cache of the upwind and downwind cells of each owned face, given a flux.
+// -----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <utility>
+
+#include "dbc.hh"
+#include "upwind_cell_cache.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+UpwindCellCache::UpwindCellCache(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                                 const Key& flux_key,
+                                 const Tag& tag)
+  : mesh_(mesh), hits_(0), lookups_(0)
+{
+  Teuchos::ParameterList plist;
+  vo_ = Teuchos::rcp(
+    new VerboseObject(mesh->getComm(), "UpwindCellCache " + Keys::getKey(flux_key, tag), plist));
+
+  int nfaces =
+    mesh->getNumEntities(AmanziMesh::Entity_kind::FACE, AmanziMesh::Parallel_kind::OWNED);
+  cells_.assign(2 * nfaces, -1);
+  dirs_.assign(2 * nfaces, 0);
+  sign_.assign(nfaces, 2); // not a sign, so that the first Update() sets all faces
+  uw_dw_.assign(2 * nfaces, -1);
+
+  for (int f = 0; f != nfaces; ++f) {
+    auto fcells = mesh->getFaceCells(f);
+    AMANZI_ASSERT(fcells.size() == 1 || fcells.size() == 2);
+
+    // Order adjacent cells as the cell loop of the upwind schemes visits them,
+    // which decides which is upwind of a zero flux.
+    int c[2] = { fcells[0], fcells.size() == 2 ? fcells[1] : -1 };
+    if (c[1] >= 0 && c[1] < c[0]) std::swap(c[0], c[1]);
+
+    for (int n = 0; n != 2; ++n) {
+      if (c[n] < 0) continue;
+      const auto& [faces, fdirs] = mesh->getCellFacesAndDirections(c[n]);
+      for (unsigned int m = 0; m != faces.size(); ++m) {
+        if (faces[m] == f) dirs_[2 * f + n] = fdirs[m];
+      }
+      cells_[2 * f + n] = c[n];
+    }
+  }
+}
+
+
+void
+UpwindCellCache::Update(const Epetra_MultiVector& flux)
+{
+  int nfaces = sign_.size();
+  AMANZI_ASSERT(flux.MyLength() == nfaces);
+
+  int nchanged = 0;
+  for (int f = 0; f != nfaces; ++f) {
+    double q = flux[0][f];
+    signed char sign = q > 0 ? 1 : (q < 0 ? -1 : 0);
+    if (sign != sign_[f]) {
+      UpdateFace_(f, sign);
+      nchanged++;
+    }
+  }
+
+  lookups_++;
+  if (nchanged == 0) {
+    hits_++;
+  } else if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "flux changed direction on " << nchanged << " faces, reused " << hits_
+               << " of " << lookups_ << " times (" << (100. * hits_) / lookups_ << "%)"
+               << std::endl;
+  }
+}
+
+
+// Same rules as the cell loop it replaces: a cell is upwind if the flux
+// leaves it, downwind if the flux enters it, and for zero flux the first
+// cell is upwind and the second downwind.
+void
+UpwindCellCache::UpdateFace_(int f, signed char sign)
+{
+  int uw = -1;
+  int dw = -1;
+  for (int n = 0; n != 2; ++n) {
+    int c = cells_[2 * f + n];
+    if (c < 0) continue;
+
+    int dir_sign = sign * dirs_[2 * f + n];
+    if (dir_sign > 0) {
+      uw = c;
+    } else if (dir_sign < 0) {
+      dw = c;
+    } else if (uw == -1) {
+      uw = c;
+    } else {
+      dw = c;
+    }
+  }
+
+  uw_dw_[2 * f] = uw;
+  uw_dw_[2 * f + 1] = dw;
+  sign_[f] = sign;
+}
+
+} // namespace Operators
+} // namespace Amanzi
@@ -0,0 +1,82 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// Cache of the upwind and downwind cells of each owned face, given a flux.
+//
+// Flux-based upwinding schemes need, for every face, the cell that the flux
+// comes from and the cell it goes to.  These depend only on the sign of the
+// flux, which rarely changes from one call to the next, while finding them
+// from scratch means walking the faces of every cell.  This cache keeps the
+// face-cell adjacency of the mesh, the upwind/downwind cells, and the flux
+// sign they were computed for, and only recomputes faces whose flux sign has
+// changed.
+//
+// Each upwinding scheme owns its cache, and rebuilds it if called with a
+// different mesh.  Caches are not shared, so schemes of different subdomains
+// may be updated concurrently.
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_UPWINDING_CELL_CACHE_
+#define AMANZI_UPWINDING_CELL_CACHE_
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Epetra_MultiVector.h"
+
+#include "Key.hh"
+#include "Tag.hh"
+#include "Mesh.hh"
+#include "VerboseObject.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+class UpwindCellCache {
+ public:
+  UpwindCellCache(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                  const Key& flux_key,
+                  const Tag& tag);
+
+  // Brings upwind/downwind cells up to date with the sign of the owned face
+  // flux.
+  void Update(const Epetra_MultiVector& flux);
+
+  // Upwind and downwind cells of owned face f, -1 if that side is the
+  // boundary.  Either may be a ghost cell.
+  int upwind(int f) const { return uw_dw_[2 * f]; }
+  int downwind(int f) const { return uw_dw_[2 * f + 1]; }
+
+  const AmanziMesh::Mesh* mesh() const { return mesh_.get(); }
+  long hits() const { return hits_; }
+  long lookups() const { return lookups_; }
+
+ private:
+  void UpdateFace_(int f, signed char sign);
+
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
+  Teuchos::RCP<VerboseObject> vo_;
+
+  // per owned face: adjacent cells in increasing order (-1 for none), the
+  // face direction relative to each, and the flux sign of uw_dw_
+  std::vector<int> cells_;
+  std::vector<int> dirs_;
+  std::vector<signed char> sign_;
+  std::vector<int> uw_dw_;
+
+  long hits_, lookups_;
+};
+
+} // namespace Operators
+} // namespace Amanzi
+
+#endif
@@ -61,6 +61,9 @@ class UpwindFluxFOCont : public Upwinding {
   std::string elevation_;
   double slope_regularization_;
   double manning_exp_;
+
+  // upwind/downwind cells of each face on flux_, owned by this scheme
+  mutable Teuchos::RCP<UpwindCellCache> uw_cells_;
 };
 
 } // namespace Operators
@@ -58,6 +58,9 @@ class UpwindFluxHarmonicMean : public Upwinding {
   std::string pkname_;
   Key flux_;
   double flux_eps_;
+
+  // upwind/downwind cells of each face on flux_, owned by this scheme
+  mutable Teuchos::RCP<UpwindCellCache> uw_cells_;
 };
 
 } // namespace Operators
@@ -20,7 +20,7 @@
 #include "Debugger.hh"
 #include "VerboseObject.hh"
 #include "upwind_flux_split_denominator.hh"
-#include "Epetra_IntVector.h"
+#include "upwind_cell_cache.hh"
 
 namespace Amanzi {
 namespace Operators {
@@ -84,37 +84,10 @@ UpwindFluxSplitDenominator::CalculateCoefficientsOnFaces(const CompositeVector&
 
   // Identify upwind/downwind cells for each local face.  Note upwind/downwind
   // may be a ghost cell.
-  Epetra_IntVector upwind_cell(*face_coef.ComponentMap("face", true));
-  upwind_cell.PutValue(-1);
-  Epetra_IntVector downwind_cell(*face_coef.ComponentMap("face", true));
-  downwind_cell.PutValue(-1);
-
-  int nfaces_local = flux.size("face", false);
-
-  int ncells = cell_coef.size("cell", true);
-  for (int c = 0; c != ncells; ++c) {
-    const auto& [faces, fdirs] = mesh->getCellFacesAndDirections(c);
-
-    for (unsigned int n = 0; n != faces.size(); ++n) {
-      int f = faces[n];
-
-      if (f < nfaces_local) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
-    }
+  if (uw_cells_ == Teuchos::null || uw_cells_->mesh() != mesh.get()) {
+    uw_cells_ = Teuchos::rcp(new UpwindCellCache(mesh, flux_, tag_));
   }
+  uw_cells_->Update(flux_v);
 
   // Determine the face coefficient of local faces.
   // These parameters may be key to a smooth convergence rate near zero flux.
@@ -122,8 +95,8 @@ UpwindFluxSplitDenominator::CalculateCoefficientsOnFaces(const CompositeVector&
   //  double min_flow_eps = 1.e-8;
   int nfaces = face_coef.size("face", false);
   for (int f = 0; f != nfaces; ++f) {
-    int uw = upwind_cell[f];
-    int dw = downwind_cell[f];
+    int uw = uw_cells_->upwind(f);
+    int dw = uw_cells_->downwind(f);
     AMANZI_ASSERT(!((uw == -1) && (dw == -1)));
 
     double denominator = 0.0;
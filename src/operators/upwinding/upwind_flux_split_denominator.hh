@@ -60,6 +60,9 @@ class UpwindFluxSplitDenominator : public Upwinding {
   double flux_eps_;
   double slope_regularization_;
   std::string ponded_depth_;
+
+  // upwind/downwind cells of each face on flux_, owned by this scheme
+  mutable Teuchos::RCP<UpwindCellCache> uw_cells_;
 };
 
 } // namespace Operators
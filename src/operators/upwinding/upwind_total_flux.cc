@@ -20,7 +20,7 @@
 #include "Debugger.hh"
 #include "VerboseObject.hh"
 #include "upwind_total_flux.hh"
-#include "Epetra_IntVector.h"
+#include "upwind_cell_cache.hh"
 
 namespace Amanzi {
 namespace Operators {
@@ -78,42 +78,17 @@ UpwindTotalFlux::CalculateCoefficientsOnFaces(const CompositeVector& cell_coef,
 
   // Identify upwind/downwind cells for each local face.  Note upwind/downwind
   // may be a ghost cell.
-  Epetra_IntVector upwind_cell(*face_coef.ComponentMap(face_component, true));
-  upwind_cell.PutValue(-1);
-  Epetra_IntVector downwind_cell(*face_coef.ComponentMap(face_component, true));
-  downwind_cell.PutValue(-1);
-
-  int nfaces_local = flux.size("face", false);
+  if (uw_cells_ == Teuchos::null || uw_cells_->mesh() != mesh.get()) {
+    uw_cells_ = Teuchos::rcp(new UpwindCellCache(mesh, flux_, tag_));
+  }
+  uw_cells_->Update(flux_v);
 
   bool has_cells = face_coef.HasComponent("cell");
   Teuchos::RCP<Epetra_MultiVector> face_cell_coef;
   if (has_cells) face_cell_coef = face_coef.ViewComponent("cell", true);
-
-  int ncells = cell_coef.size(cell_component, true);
-  for (int c = 0; c != ncells; ++c) {
-    const auto& [faces, fdirs] = mesh->getCellFacesAndDirections(c);
-
-    for (unsigned int n = 0; n != faces.size(); ++n) {
-      int f = faces[n];
-
-      if (has_cells) (*face_cell_coef)[0][c] = coef_cells[0][c];
-
-      if (f < nfaces_local) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
-    }
+  if (has_cells) {
+    int ncells = cell_coef.size(cell_component, true);
+    for (int c = 0; c != ncells; ++c) (*face_cell_coef)[0][c] = coef_cells[0][c];
   }
 
   // Determine the face coefficient of local faces.
@@ -124,8 +99,8 @@ UpwindTotalFlux::CalculateCoefficientsOnFaces(const CompositeVector& cell_coef,
 
   int nfaces = face_coef.size(face_component, false);
   for (int f = 0; f != nfaces; ++f) {
-    int uw = upwind_cell[f];
-    int dw = downwind_cell[f];
+    int uw = uw_cells_->upwind(f);
+    int dw = uw_cells_->downwind(f);
     AMANZI_ASSERT(!((uw == -1) && (dw == -1)));
 
     // uw coef
@@ -211,40 +186,15 @@ UpwindTotalFlux::UpdateDerivatives(
 
   // Identify upwind/downwind cells for each local face.  Note upwind/downwind
   // may be a ghost cell.
-  Epetra_IntVector upwind_cell(mesh->getMap(AmanziMesh::Entity_kind::FACE, true));
-  upwind_cell.PutValue(-1);
-  Epetra_IntVector downwind_cell(mesh->getMap(AmanziMesh::Entity_kind::FACE, true));
-  downwind_cell.PutValue(-1);
-
-  int ncells = dcell_v.MyLength();
-  for (int c = 0; c != ncells; ++c) {
-    const auto& [faces, fdirs] = mesh->getCellFacesAndDirections(c);
-
-    for (unsigned int n = 0; n != faces.size(); ++n) {
-      int f = faces[n];
-
-      if (f < nfaces_owned) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
-    }
+  if (uw_cells_ == Teuchos::null || uw_cells_->mesh() != mesh.get()) {
+    uw_cells_ = Teuchos::rcp(new UpwindCellCache(mesh, flux_, tag_));
   }
+  uw_cells_->Update(flux_v);
 
 
   for (unsigned int f = 0; f != nfaces_owned; ++f) {
-    int uw = upwind_cell[f];
-    int dw = downwind_cell[f];
+    int uw = uw_cells_->upwind(f);
+    int dw = uw_cells_->downwind(f);
     AMANZI_ASSERT(!((uw == -1) && (dw == -1)));
 
     auto cells = mesh->getFaceCells(f);
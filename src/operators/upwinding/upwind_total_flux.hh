@@ -67,6 +67,9 @@ class UpwindTotalFlux : public Upwinding {
   Tag tag_;
   std::string flux_;
   double flux_eps_;
+
+  // upwind/downwind cells of each face on flux_, owned by this scheme
+  mutable Teuchos::RCP<UpwindCellCache> uw_cells_;
 };
 
 } // namespace Operators
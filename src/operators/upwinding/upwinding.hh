@@ -33,6 +33,8 @@ class CompositeVector;
 
 namespace Operators {
 
+class UpwindCellCache;
+
 enum UpwindMethod {
   UPWIND_METHOD_CENTERED = 0,
   UPWIND_METHOD_GRAVITY,
@@ -15,6 +15,7 @@
 
 */
 
+#include "dbc.hh"
 #include "utils.hh"
 
 #include "PFT.hh"
@@ -155,6 +156,86 @@ PFT::Init(Teuchos::ParameterList& plist, double col_area)
 }
 
 
+// Names of the state variables, in the order of GetState()
+std::vector<std::string>
+PFT::StateNames()
+{
+  std::vector<std::string> names = { "Bleaf",        "Bleafmemory",  "Broot",      "Bstem",
+                                     "Bstore",       "GDD",          "mResp",      "gResp",
+                                     "annNPP",       "GPP",          "NPP",        "ET",
+                                     "leafstatus",   "lai",          "laimemory",  "totalBiomass",
+                                     "rootD",        "bleafon",      "bleafoff",   "leafondaysi",
+                                     "leafoffdaysi", "CSinkLimit",   "maxLAI" };
+  for (int i = 0; i != 10; ++i) names.push_back("annCBalance_" + std::to_string(i));
+  AMANZI_ASSERT(names.size() == num_state);
+  return names;
+}
+
+
+void
+PFT::GetState(double* state) const
+{
+  int k = 0;
+  state[k++] = Bleaf;
+  state[k++] = Bleafmemory;
+  state[k++] = Broot;
+  state[k++] = Bstem;
+  state[k++] = Bstore;
+  state[k++] = GDD;
+  state[k++] = mResp;
+  state[k++] = gResp;
+  state[k++] = annNPP;
+  state[k++] = GPP;
+  state[k++] = NPP;
+  state[k++] = ET;
+  state[k++] = leafstatus;
+  state[k++] = lai;
+  state[k++] = laimemory;
+  state[k++] = totalBiomass;
+  state[k++] = rootD;
+  state[k++] = bleafon;
+  state[k++] = bleafoff;
+  state[k++] = leafondaysi;
+  state[k++] = leafoffdaysi;
+  state[k++] = CSinkLimit;
+  state[k++] = maxLAI;
+  for (int i = 0; i != 10; ++i) state[k++] = annCBalance[i];
+  AMANZI_ASSERT(k == num_state);
+}
+
+
+void
+PFT::SetState(const double* state)
+{
+  int k = 0;
+  Bleaf = state[k++];
+  Bleafmemory = state[k++];
+  Broot = state[k++];
+  Bstem = state[k++];
+  Bstore = state[k++];
+  GDD = state[k++];
+  mResp = state[k++];
+  gResp = state[k++];
+  annNPP = state[k++];
+  GPP = state[k++];
+  NPP = state[k++];
+  ET = state[k++];
+  leafstatus = (int)state[k++];
+  lai = state[k++];
+  laimemory = state[k++];
+  totalBiomass = state[k++];
+  rootD = state[k++];
+  bleafon = state[k++];
+  bleafoff = (int)state[k++];
+  leafondaysi = state[k++];
+  leafoffdaysi = state[k++];
+  CSinkLimit = state[k++];
+  maxLAI = (int)state[k++];
+  for (int i = 0; i != 10; ++i) annCBalance[i] = state[k++];
+  AMANZI_ASSERT(k == num_state);
+}
+
+
 // Initialize the root distribution
 void
 PFT::InitRoots(const Epetra_SerialDenseVector& SoilTArr,
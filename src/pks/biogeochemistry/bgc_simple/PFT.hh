@@ -36,6 +36,9 @@ Paramters for a plant functional type.
 #ifndef ATS_BGC_PFT_HH_
 #define ATS_BGC_PFT_HH_
 
+#include <string>
+#include <vector>
+
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_RCP.hpp"
 #include "Epetra_SerialDenseVector.h"
@@ -70,6 +73,15 @@ class PFT {
     return std::abs(totalRootW - Broot) < 1.e-6;
   }
 
+  // The state of a PFT, as opposed to its parameters, is everything that is
+  // evolved by BGCAdvance other than BRootSoil.  It is copied to and from
+  // arrays of num_state values, ordered as StateNames(), so that it can be
+  // stored in State.
+  static const int num_state = 33;
+  static std::vector<std::string> StateNames();
+  void GetState(double* state) const;
+  void SetState(const double* state);
+
 
   double Bleaf;              //kg c/m2 land
   double Bleafmemory;        //kg c/m2 land, leaf biomass for the last year
@@ -17,8 +17,12 @@
      1. parallel decomp not in the vertical
      2. fields are not ordered along the column, and so must be copied
      3. all columns have the same number of cells
+
+   Columns are independent, and are advanced concurrently by host threads.
    ------------------------------------------------------------------------- */
 
+#include "Kokkos_Core.hpp"
+
 #include "MeshPartition.hh"
 #include "pk_helpers.hh"
 #include "bgc_simple_funcs.hh"
@@ -50,6 +54,9 @@ BGCSimple::BGCSimple(Teuchos::ParameterList& pk_tree,
   // -- lai
   total_lai_key_ =
     Keys::readKey(*plist_, domain_surf_, "total leaf area index", "total_leaf_area_index");
+  // -- PFT state
+  pft_state_key_ = Keys::readKey(*plist_, domain_surf_, "pft state", "pft_state");
+  pft_root_key_ = Keys::readKey(*plist_, domain_, "pft root biomass", "pft_root_biomass");
 
   // initial timestep
   dt_ = plist_->get<double>("initial time step", 1.);
@@ -85,7 +92,7 @@ BGCSimple::Setup()
       Teuchos::rcp(new SoilCarbonParameters(num_pools_, sc_params.sublist(region))));
   }
 
-  // -- PFTs -- old and new!
+  // -- PFTs
   Teuchos::ParameterList& pft_params = plist_->sublist("pft parameters");
   std::vector<std::string> pft_names;
   for (Teuchos::ParameterList::ConstIterator lcv = pft_params.begin(); lcv != pft_params.end();
@@ -99,7 +106,6 @@ BGCSimple::Setup()
   num_cols_ =
     mesh_surf_->getNumEntities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
 
-  pfts_old_.resize(num_cols_);
   pfts_.resize(num_cols_);
   for (unsigned int col = 0; col != num_cols_; ++col) {
     int f = mesh_surf_->getEntityParent(AmanziMesh::Entity_kind::CELL, col);
@@ -118,29 +124,29 @@ BGCSimple::Setup()
       AMANZI_ASSERT(ncol_cells == ncells_per_col_);
     }
 
-    pfts_old_[col].resize(num_pfts_);
     pfts_[col].resize(num_pfts_);
 
     for (int i = 0; i != num_pfts_; ++i) {
       std::string pft_name = pft_names[i];
       Teuchos::ParameterList& pft_plist = pft_params.sublist(pft_name);
-      pfts_old_[col][i] = Teuchos::rcp(new PFT(pft_name, ncol_cells));
-      pfts_old_[col][i]->Init(pft_plist, col_area);
-      pfts_[col][i] = Teuchos::rcp(new PFT(*pfts_old_[col][i]));
+      pfts_[col][i] = Teuchos::rcp(new PFT(pft_name, ncol_cells));
+      pfts_[col][i]->Init(pft_plist, col_area);
     }
   }
 
-  // -- soil carbon pools
+  // -- soil carbon pools, views into the column-contiguous store
+  som_.assign(std::max(num_cols_ * ncells_per_col_ * num_pools_, 0), 0.);
   soil_carbon_pools_.resize(num_cols_);
   for (unsigned int col = 0; col != num_cols_; ++col) {
     soil_carbon_pools_[col].resize(ncells_per_col_);
 
     auto col_iter = mesh_->columns.getCells(col);
-    ncells_per_col_ = col_iter.size();
+    double* som_col = &som_[(std::size_t)col * ncells_per_col_ * num_pools_];
 
     for (std::size_t i = 0; i != col_iter.size(); ++i) {
       // col_iter[i] = cell id, mp[cell_id] = index into partition list, sc_params_[index] = correct params
-      soil_carbon_pools_[col][i] = Teuchos::rcp(new SoilCarbon(sc_params_[mp[col_iter[i]]]));
+      soil_carbon_pools_[col][i] =
+        Teuchos::rcp(new SoilCarbon(sc_params_[mp[col_iter[i]]], som_col + i * num_pools_));
     }
   }
 
@@ -168,6 +174,26 @@ BGCSimple::Setup()
     ->SetComponent("cell", AmanziMesh::Entity_kind::CELL, 1);
   requireEvaluatorPrimary(total_lai_key_, tag_next_, *S_);
 
+  // requirements: PFT state, which evolves like a primary variable
+  std::vector<std::string> state_names = PFT::StateNames();
+  std::vector<std::string> pft_state_names;
+  for (const auto& pft_name : pft_names) {
+    for (const auto& state_name : state_names) {
+      pft_state_names.push_back(pft_name + "_" + state_name);
+    }
+  }
+  requireAtNext(pft_state_key_, tag_next_, *S_, name_)
+    .SetMesh(mesh_surf_)
+    ->SetComponent("cell", AmanziMesh::Entity_kind::CELL, num_pfts_ * PFT::num_state);
+  requireAtCurrent(pft_state_key_, tag_current_, *S_, name_);
+  S_->GetRecordSetW(pft_state_key_).set_subfieldnames(pft_state_names);
+
+  requireAtNext(pft_root_key_, tag_next_, *S_, name_)
+    .SetMesh(mesh_)
+    ->SetComponent("cell", AmanziMesh::Entity_kind::CELL, num_pfts_);
+  requireAtCurrent(pft_root_key_, tag_current_, *S_, name_);
+  S_->GetRecordSetW(pft_root_key_).set_subfieldnames(pft_names);
+
   // requirement: diagnostics
   S_->Require<CompositeVector, CompositeVectorSpace>("co2_decomposition", tag_next_, name_)
     .SetMesh(mesh_)
@@ -287,7 +313,7 @@ BGCSimple::Initialize()
         int num_cols_ = mesh_surf_->getNumEntities(AmanziMesh::Entity_kind::CELL,
                                                    AmanziMesh::Parallel_kind::OWNED);
         for (int col = 0; col != num_cols_; ++col) {
-          for (int i = 0; i != bio.NumVectors(); ++i) { pfts_old_[col][i]->Bleaf = bio[i][col]; }
+          for (int i = 0; i != bio.NumVectors(); ++i) { pfts_[col][i]->Bleaf = bio[i][col]; }
         }
       }
     }
@@ -298,31 +324,40 @@ BGCSimple::Initialize()
     }
   }
 
+  // column geometry, which does not change
+  int num_cols_ =
+    mesh_surf_->getNumEntities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+  int ncells = ncells_per_col_;
+  col_depth_.resize(num_cols_ * ncells);
+  col_dz_.resize(num_cols_ * ncells);
+
   // init root carbon
   auto col_temp = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto col_depth = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto col_dz = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
 
   S_->GetEvaluator("temperature", tag_next_).Update(*S_, name_);
   const Epetra_Vector& temp =
     *(*S_->Get<CompositeVector>("temperature", tag_next_).ViewComponent("cell", false))(0);
 
-  int num_cols_ =
-    mesh_surf_->getNumEntities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
   for (int col = 0; col != num_cols_; ++col) {
+    Epetra_SerialDenseVector col_depth(View, &col_depth_[col * ncells], ncells);
+    Epetra_SerialDenseVector col_dz(View, &col_dz_[col * ncells], ncells);
     FieldToColumn_(col, temp, col_temp.ptr());
-    ColDepthDz_(col, col_depth.ptr(), col_dz.ptr());
+    ColDepthDz_(col, Teuchos::ptr(&col_depth), Teuchos::ptr(&col_dz));
 
     for (int i = 0; i != num_pfts_; ++i) {
-      pfts_old_[col][i]->InitRoots(*col_temp, *col_depth, *col_dz);
+      pfts_[col][i]->InitRoots(*col_temp, col_depth, col_dz);
     }
   }
 
-  // ensure all initialization in both PFTs?  Not sure this is
-  // necessary -- likely done in initial call to commit-state --etc
-  for (int col = 0; col != num_cols_; ++col) {
-    for (int i = 0; i != num_pfts_; ++i) { *pfts_[col][i] = *pfts_old_[col][i]; }
-  }
+  // the initial PFT state, which is overwritten by the checkpoint on restart
+  Epetra_MultiVector& pft_state =
+    *S_->GetW<CompositeVector>(pft_state_key_, tag_next_, name_).ViewComponent("cell", false);
+  Epetra_MultiVector& pft_root =
+    *S_->GetW<CompositeVector>(pft_root_key_, tag_next_, name_).ViewComponent("cell", false);
+  pft_root.PutScalar(0.);
+  for (int col = 0; col != num_cols_; ++col) PFTsToState_(col, pft_state, pft_root);
+  S_->GetRecordW(pft_state_key_, tag_next_, name_).set_initialized();
+  S_->GetRecordW(pft_root_key_, tag_next_, name_).set_initialized();
 }
 
 
@@ -330,15 +365,10 @@ BGCSimple::Initialize()
 void
 BGCSimple::CommitStep(double told, double tnew, const Tag& tag)
 {
-  // Copy the PFT over, which includes all additional state required, commit
-  // the step as succesful.
-  double dt = tnew - told;
-
-  int num_cols_ =
-    mesh_surf_->getNumEntities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
-  for (int col = 0; col != num_cols_; ++col) {
-    for (int i = 0; i != num_pfts_; ++i) { *pfts_old_[col][i] = *pfts_[col][i]; }
-  }
+  // Copy the PFT state over, commit the step as succesful.
+  Tag tag_current = tag == tag_next_ ? tag_current_ : Tags::CURRENT;
+  assign(pft_state_key_, tag_current, tag, *S_);
+  assign(pft_root_key_, tag_current, tag, *S_);
 }
 
 // -- advance the model
@@ -354,16 +384,21 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
                << " t1 = " << S_->get_time(tag_next_) << " h = " << dt << std::endl
                << "----------------------------------------------------------------" << std::endl;
 
-  // Copy the PFT from old to new, in case we failed the previous attempt at
-  // this timestep.  This is hackery to get around the fact that PFTs are not
-  // (but should be) in state.
   AmanziMesh::Entity_ID num_cols_ =
     mesh_surf_->getNumEntities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
-  for (AmanziMesh::Entity_ID col = 0; col != num_cols_; ++col) {
-    for (int i = 0; i != num_pfts_; ++i) { *pfts_[col][i] = *pfts_old_[col][i]; }
-  }
 
   // grab the required fields
+  // -- PFTs always start from the state at the beginning of the step, so a
+  //    failed attempt at this step needs no special handling
+  const Epetra_MultiVector& pft_state_old =
+    *S_->Get<CompositeVector>(pft_state_key_, tag_current_).ViewComponent("cell", false);
+  const Epetra_MultiVector& pft_root_old =
+    *S_->Get<CompositeVector>(pft_root_key_, tag_current_).ViewComponent("cell", false);
+  Epetra_MultiVector& pft_state =
+    *S_->GetW<CompositeVector>(pft_state_key_, tag_next_, name_).ViewComponent("cell", false);
+  Epetra_MultiVector& pft_root =
+    *S_->GetW<CompositeVector>(pft_root_key_, tag_next_, name_).ViewComponent("cell", false);
+
   Epetra_MultiVector& sc_pools =
     *S_->GetW<CompositeVector>(key_, tag_next_, name_).ViewComponent("cell", false);
   Epetra_MultiVector& co2_decomp =
@@ -425,95 +460,95 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
   const Epetra_MultiVector& scv =
     *S_->Get<CompositeVector>("surface-cell_volume", tag_next_).ViewComponent("cell", false);
 
-  // Create workspace arrays (these should be removed when data is correctly oriented).
-  auto temp_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto pres_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto dz_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto depth_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-
-  // Create a workspace array for the result
-  Epetra_SerialDenseVector co2_decomp_c(ncells_per_col_);
-  Epetra_SerialDenseVector trans_c(ncells_per_col_);
-  double sw_c(0.);
-
   total_lai.PutScalar(0.);
 
-  // loop over columns and apply the model
-  for (AmanziMesh::Entity_ID col = 0; col != num_cols_; ++col) {
-    // update the various soil arrays
-    FieldToColumn_(col, *temp(0), temp_c.ptr());
-    FieldToColumn_(col, *pres(0), pres_c.ptr());
-    ColDepthDz_(col, depth_c.ptr(), dz_c.ptr());
-
-    // copy over the soil carbon arrays
-    auto col_iter = mesh_->columns.getCells(col);
-    ncells_per_col_ = col_iter.size();
-
-    // -- serious cache thrash... --etc
-    for (std::size_t i = 0; i != col_iter.size(); ++i) {
-      AmanziGeometry::Point centroid = mesh_->getCellCentroid(col_iter[i]);
-      //      std::cout << "Col iter col=" << col << ", index i=" << i << ", cell=" << col_iter[i] << " at " << centroid << std::endl;
-      for (int p = 0; p != soil_carbon_pools_[col][i]->nPools; ++p) {
-        soil_carbon_pools_[col][i]->SOM[p] = sc_pools[p][col_iter[i]];
-      }
-    }
-
-    // Create the Met data struct
-    MetData met;
-    met.qSWin = qSWin[0][col];
-    met.tair = air_temp[0][col];
-    met.windv = wind_speed[0][col];
-    met.wind_ref_ht = wind_speed_ref_ht_;
-    met.vp_air = vp_air[0][col];
-    met.CO2a = co2[0][col];
-    met.lat = lat_;
-    sw_c = met.qSWin;
-
-    // call the model
-    BGCAdvance(S_->get_time(tag_current_),
-               dt,
-               scv[0][col],
-               cryoturbation_coef_,
-               met,
-               *temp_c,
-               *pres_c,
-               *depth_c,
-               *dz_c,
-               pfts_[col],
-               soil_carbon_pools_[col],
-               co2_decomp_c,
-               trans_c,
-               sw_c);
-
-    // copy back
-    // -- serious cache thrash... --etc
-    for (std::size_t i = 0; i != col_iter.size(); ++i) {
-      for (int p = 0; p != soil_carbon_pools_[col][i]->nPools; ++p) {
-        sc_pools[p][col_iter[i]] = soil_carbon_pools_[col][i]->SOM[p];
+  // Loop over columns and apply the model.  Each column only writes to its
+  // own cells, PFTs and soil carbon pools, so columns are independent.
+  int ncells = ncells_per_col_;
+  double t_current = S_->get_time(tag_current_);
+  Kokkos::parallel_for(
+    "BGCSimple::AdvanceStep",
+    Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, num_cols_),
+    [&](const int col) {
+      auto col_iter = mesh_->columns.getCells(col);
+      PFTsFromState_(col, pft_state_old, pft_root_old);
+
+      // update the various soil arrays
+      Epetra_SerialDenseVector temp_c(ncells);
+      Epetra_SerialDenseVector pres_c(ncells);
+      FieldToColumn_(col, *temp(0), temp_c.Values(), ncells);
+      FieldToColumn_(col, *pres(0), pres_c.Values(), ncells);
+      Epetra_SerialDenseVector depth_c(View, &col_depth_[col * ncells], ncells);
+      Epetra_SerialDenseVector dz_c(View, &col_dz_[col * ncells], ncells);
+
+      // copy over the soil carbon arrays, which soil_carbon_pools_ view
+      double* som_col = &som_[(std::size_t)col * ncells * num_pools_];
+      for (int i = 0; i != ncells; ++i) {
+        for (int p = 0; p != num_pools_; ++p) {
+          som_col[i * num_pools_ + p] = sc_pools[p][col_iter[i]];
+        }
       }
 
-      // and integrate the decomp
-      co2_decomp[0][col_iter[i]] += co2_decomp_c[i];
+      // Create the Met data struct
+      MetData met;
+      met.qSWin = qSWin[0][col];
+      met.tair = air_temp[0][col];
+      met.windv = wind_speed[0][col];
+      met.wind_ref_ht = wind_speed_ref_ht_;
+      met.vp_air = vp_air[0][col];
+      met.CO2a = co2[0][col];
+      met.lat = lat_;
+
+      // Create a workspace array for the result
+      Epetra_SerialDenseVector co2_decomp_c(ncells);
+      Epetra_SerialDenseVector trans_c(ncells);
+      double sw_c = met.qSWin;
+
+      // call the model
+      BGCAdvance(t_current,
+                 dt,
+                 scv[0][col],
+                 cryoturbation_coef_,
+                 met,
+                 temp_c,
+                 pres_c,
+                 depth_c,
+                 dz_c,
+                 pfts_[col],
+                 soil_carbon_pools_[col],
+                 co2_decomp_c,
+                 trans_c,
+                 sw_c);
+
+      // copy back
+      for (int i = 0; i != ncells; ++i) {
+        for (int p = 0; p != num_pools_; ++p) {
+          sc_pools[p][col_iter[i]] = som_col[i * num_pools_ + p];
+        }
 
+        // and integrate the decomp
+        co2_decomp[0][col_iter[i]] += co2_decomp_c[i];
 
-      // and pull in the transpiration, converting to mol/m^3/s, as a sink
-      trans[0][col_iter[i]] = trans_c[i] / .01801528;
+        // and pull in the transpiration, converting to mol/m^3/s, as a sink
+        trans[0][col_iter[i]] = trans_c[i] / .01801528;
+      }
       sw[0][col] = sw_c;
-    }
 
-    for (int lcv_pft = 0; lcv_pft != pfts_[col].size(); ++lcv_pft) {
-      biomass[lcv_pft][col] = pfts_[col][lcv_pft]->totalBiomass;
-      leafbiomass[lcv_pft][col] = pfts_[col][lcv_pft]->Bleaf;
-      csink[lcv_pft][col] = pfts_[col][lcv_pft]->CSinkLimit;
-      lai[lcv_pft][col] = pfts_[col][lcv_pft]->lai;
+      for (int lcv_pft = 0; lcv_pft != pfts_[col].size(); ++lcv_pft) {
+        biomass[lcv_pft][col] = pfts_[col][lcv_pft]->totalBiomass;
+        leafbiomass[lcv_pft][col] = pfts_[col][lcv_pft]->Bleaf;
+        csink[lcv_pft][col] = pfts_[col][lcv_pft]->CSinkLimit;
+        lai[lcv_pft][col] = pfts_[col][lcv_pft]->lai;
 
-      total_transpiration[lcv_pft][col] = pfts_[col][lcv_pft]->ET / 0.01801528;
-      total_lai[0][col] += pfts_[col][lcv_pft]->lai;
-    }
-
-  } // end loop over columns
+        total_transpiration[lcv_pft][col] = pfts_[col][lcv_pft]->ET / 0.01801528;
+        total_lai[0][col] += pfts_[col][lcv_pft]->lai;
+      }
+      PFTsToState_(col, pft_state, pft_root);
+    });
 
   // mark primaries as changed
+  changedEvaluatorPrimary(pft_state_key_, tag_next_, *S_);
+  changedEvaluatorPrimary(pft_root_key_, tag_next_, *S_);
   changedEvaluatorPrimary(trans_key_, tag_next_, *S_);
   changedEvaluatorPrimary(shaded_sw_key_, tag_next_, *S_);
   changedEvaluatorPrimary(total_lai_key_, tag_next_, *S_);
@@ -548,6 +583,39 @@ BGCSimple::FieldToColumn_(AmanziMesh::Entity_ID col,
 }
 
 
+// helper functions for copying PFT state between the PFTs of a column and
+// State, where component k of PFT i is stored in vector i * num_state + k
+void
+BGCSimple::PFTsFromState_(AmanziMesh::Entity_ID col,
+                          const Epetra_MultiVector& pft_state,
+                          const Epetra_MultiVector& pft_root)
+{
+  auto col_iter = mesh_->columns.getCells(col);
+  double state[PFT::num_state];
+  for (int i = 0; i != num_pfts_; ++i) {
+    PFT& pft = *pfts_[col][i];
+    for (int k = 0; k != PFT::num_state; ++k) state[k] = pft_state[i * PFT::num_state + k][col];
+    pft.SetState(state);
+    for (std::size_t j = 0; j != col_iter.size(); ++j) pft.BRootSoil[j] = pft_root[i][col_iter[j]];
+  }
+}
+
+void
+BGCSimple::PFTsToState_(AmanziMesh::Entity_ID col,
+                        Epetra_MultiVector& pft_state,
+                        Epetra_MultiVector& pft_root) const
+{
+  auto col_iter = mesh_->columns.getCells(col);
+  double state[PFT::num_state];
+  for (int i = 0; i != num_pfts_; ++i) {
+    const PFT& pft = *pfts_[col][i];
+    pft.GetState(state);
+    for (int k = 0; k != PFT::num_state; ++k) pft_state[i * PFT::num_state + k][col] = state[k];
+    for (std::size_t j = 0; j != col_iter.size(); ++j) pft_root[i][col_iter[j]] = pft.BRootSoil[j];
+  }
+}
+
+
 // helper function for collecting column dz and depth
 void
 BGCSimple::ColDepthDz_(AmanziMesh::Entity_ID col,
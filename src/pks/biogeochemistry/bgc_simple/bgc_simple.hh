@@ -64,6 +64,13 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 
   * `"total leaf area index key`" ``[string]`` **SURFACE_DOMAIN-total_leaf_area_index** Total LAI across all PFTs.
 
+  * `"pft state key`" ``[string]`` **SURFACE_DOMAIN-pft_state** State of
+    each PFT (biomass pools, phenology, and carbon balance memory), stored in
+    State so that it is checkpointed and restored on failed time steps.
+
+  * `"pft root biomass key`" ``[string]`` **DOMAIN-pft_root_biomass** Root
+    biomass of each PFT in each soil cell `[kg C m^-2]`
+
   EVALUATORS:
 
   - `"temperature`" The soil temperature `[K]`
@@ -137,6 +144,14 @@ class BGCSimple : public PK_Physical_Default {
                    Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                    Teuchos::Ptr<Epetra_SerialDenseVector> dz);
 
+  // copy the state of a column's PFTs from/to the PFT state fields
+  void PFTsFromState_(AmanziMesh::Entity_ID col,
+                      const Epetra_MultiVector& pft_state,
+                      const Epetra_MultiVector& pft_root);
+  void PFTsToState_(AmanziMesh::Entity_ID col,
+                    Epetra_MultiVector& pft_state,
+                    Epetra_MultiVector& pft_root) const;
+
  protected:
   double dt_;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_surf_;
@@ -144,10 +159,19 @@ class BGCSimple : public PK_Physical_Default {
 
   // physical structs needed by model
   std::vector<Teuchos::RCP<SoilCarbonParameters>> sc_params_;
-  std::vector<std::vector<Teuchos::RCP<PFT>>> pfts_;     // this also contains state data!
-  std::vector<std::vector<Teuchos::RCP<PFT>>> pfts_old_; // need two copies for failed timesteps
+  // PFTs of each column, a workspace for the state in pft_state_key_ and
+  // pft_root_key_
+  std::vector<std::vector<Teuchos::RCP<PFT>>> pfts_;
   std::vector<std::vector<Teuchos::RCP<SoilCarbon>>> soil_carbon_pools_;
 
+  // Soil carbon pools of all columns, stored contiguously by column, then
+  // cell, then pool, and viewed in place by soil_carbon_pools_.
+  std::vector<double> som_;
+
+  // depth and thickness of column cells, stored contiguously by column
+  std::vector<double> col_depth_;
+  std::vector<double> col_dz_;
+
   // extras
   int num_pools_;
   int num_pfts_;
@@ -162,6 +186,8 @@ class BGCSimple : public PK_Physical_Default {
   Key trans_key_;
   Key shaded_sw_key_;
   Key total_lai_key_;
+  Key pft_state_key_;
+  Key pft_root_key_;
 
 
  private:
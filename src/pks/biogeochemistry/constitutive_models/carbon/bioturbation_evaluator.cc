@@ -15,6 +15,7 @@
 #include "Epetra_SerialDenseVector.h"
 
 #include "bioturbation_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace BGC {
@@ -46,6 +47,7 @@ BioturbationEvaluator::Clone() const
 void
 BioturbationEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   auto carbon_cv = S.GetPtr<CompositeVector>(carbon_key_, tag);
   const AmanziMesh::Mesh& mesh = *carbon_cv->Mesh();
@@ -104,6 +106,7 @@ BioturbationEvaluator::EvaluatePartialDerivative_(const State& S,
                                                   const Tag& wrt_tag,
                                                   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(0);
 }
 
@@ -11,6 +11,7 @@
 #include "advection_diffusion.hh"
 #include "Op.hh"
 #include "EpetraExt_RowMatrixOut.h"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -24,6 +25,7 @@ AdvectionDiffusion::FunctionalResidual(double t_old,
                                        Teuchos::RCP<TreeVector> u_new,
                                        Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
   // pointer-copy temperature into states and update any auxilary data
   Solution_to_State(*u_new, S_next_);
 
@@ -69,6 +71,7 @@ int
 AdvectionDiffusion::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
                                         Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
     *vo_->os() << "Precon application:" << std::endl;
     *vo_->os() << "  u: " << (*u->Data())("cell", 0);
@@ -92,6 +95,7 @@ AdvectionDiffusion::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
 void
 AdvectionDiffusion::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   AMANZI_ASSERT(std::abs(S_next_->time() - t) <= 1.e-4 * t);
   PK_PhysicalBDF_Default::Solution_to_State(*up, S_next_);
 
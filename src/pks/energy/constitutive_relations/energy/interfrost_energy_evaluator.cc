@@ -22,6 +22,7 @@ This is simply the conserved quantity in Richards equation.
 
 
 #include "interfrost_energy_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -63,6 +64,7 @@ InterfrostEnergyEvaluator::Clone() const
 void
 InterfrostEnergyEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   const Epetra_MultiVector& s_l =
     *S.Get<CompositeVector>("saturation_liquid", tag).ViewComponent("cell", false);
@@ -109,6 +111,7 @@ InterfrostEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
                                                       const Tag& wrt_tag,
                                                       const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   auto tag = my_keys_.front().second;
   const Epetra_MultiVector& s_l =
     *S.Get<CompositeVector>("saturation_liquid", tag).ViewComponent("cell", false);
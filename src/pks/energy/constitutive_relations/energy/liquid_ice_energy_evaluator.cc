@@ -15,6 +15,7 @@ Energy for a two-phase, liquid+ice evaluator.
 
 #include "liquid_ice_energy_evaluator.hh"
 #include "liquid_ice_energy_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -115,6 +116,7 @@ LiquidIceEnergyEvaluator::InitializeFromPlist_()
 void
 LiquidIceEnergyEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> phi0 = S.GetPtr<CompositeVector>(phi0_key_, tag);
@@ -166,6 +168,7 @@ LiquidIceEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
                                                      const Tag& wrt_tag,
                                                      const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   auto tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> phi0 = S.GetPtr<CompositeVector>(phi0_key_, tag);
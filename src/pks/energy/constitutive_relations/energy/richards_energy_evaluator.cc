@@ -15,6 +15,7 @@ Richards energy: the standard form as a function of liquid saturation and specif
 
 #include "richards_energy_evaluator.hh"
 #include "richards_energy_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -100,6 +101,7 @@ RichardsEnergyEvaluator::InitializeFromPlist_()
 void
 RichardsEnergyEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> phi0 = S.GetPtr<CompositeVector>(phi0_key_, tag);
@@ -142,6 +144,7 @@ RichardsEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
                                                     const Tag& wrt_tag,
                                                     const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> phi0 = S.GetPtr<CompositeVector>(phi0_key_, tag);
@@ -15,6 +15,7 @@ Energy evaulator for ice+liquid surface water.
 
 #include "surface_ice_energy_evaluator.hh"
 #include "surface_ice_energy_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -80,6 +81,7 @@ SurfaceIceEnergyEvaluator::InitializeFromPlist_()
 void
 SurfaceIceEnergyEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> h = S.GetPtr<CompositeVector>(h_key_, tag);
   Teuchos::RCP<const CompositeVector> eta = S.GetPtr<CompositeVector>(eta_key_, tag);
@@ -114,6 +116,7 @@ SurfaceIceEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
                                                       const Tag& wrt_tag,
                                                       const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> h = S.GetPtr<CompositeVector>(h_key_, tag);
   Teuchos::RCP<const CompositeVector> eta = S.GetPtr<CompositeVector>(eta_key_, tag);
@@ -27,4 +27,4 @@ expression = (phi*(sl*nl*ul + si*ni*ui + sg*ng*ug) + (1-phi0)*rho_r*ur) * cv;
 
 generate_evaluator("three_phase_energy", "Energy",
                    "three phase energy", "energy",
-                   deps, params, expression=expression, doc=__doc__)
+                   deps, params, expression=expression, doc=__doc__, ad=True)
@@ -15,6 +15,8 @@ Energy for a three-phase, gas+liquid+ice evaluator.
 
 #include "three_phase_energy_evaluator.hh"
 #include "three_phase_energy_model.hh"
+#include "Dual.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -22,7 +24,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 ThreePhaseEnergyEvaluator::ThreePhaseEnergyEvaluator(Teuchos::ParameterList& plist)
-  : EvaluatorSecondaryMonotypeCV(plist)
+  : EvaluatorSecondaryMonotypeCV(plist), dresult_cache_(14)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("three_phase_energy parameters");
   model_ = Teuchos::rcp(new ThreePhaseEnergyModel(sublist));
@@ -109,6 +111,7 @@ ThreePhaseEnergyEvaluator::InitializeFromPlist_()
 void
 ThreePhaseEnergyEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> phi0 = S.GetPtr<CompositeVector>(phi0_key_, tag);
@@ -125,6 +128,10 @@ ThreePhaseEnergyEvaluator::Evaluate_(const State& S, const std::vector<Composite
   Teuchos::RCP<const CompositeVector> ur = S.GetPtr<CompositeVector>(ur_key_, tag);
   Teuchos::RCP<const CompositeVector> cv = S.GetPtr<CompositeVector>(cv_key_, tag);
 
+  // partial derivatives that have been requested are computed in the same
+  // sweep as the value, all at once by evaluating the model on dual numbers
+  dresult_cache_.Invalidate();
+  bool derivs = !dresult_cache_.Empty();
   for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
     const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
     const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
@@ -141,25 +148,72 @@ ThreePhaseEnergyEvaluator::Evaluate_(const State& S, const std::vector<Composite
     const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
     const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+    double* dresult_phi = dresult_cache_.View(0, *comp);
+    double* dresult_phi0 = dresult_cache_.View(1, *comp);
+    double* dresult_sl = dresult_cache_.View(2, *comp);
+    double* dresult_nl = dresult_cache_.View(3, *comp);
+    double* dresult_ul = dresult_cache_.View(4, *comp);
+    double* dresult_si = dresult_cache_.View(5, *comp);
+    double* dresult_ni = dresult_cache_.View(6, *comp);
+    double* dresult_ui = dresult_cache_.View(7, *comp);
+    double* dresult_sg = dresult_cache_.View(8, *comp);
+    double* dresult_ng = dresult_cache_.View(9, *comp);
+    double* dresult_ug = dresult_cache_.View(10, *comp);
+    double* dresult_rho_r = dresult_cache_.View(11, *comp);
+    double* dresult_ur = dresult_cache_.View(12, *comp);
+    double* dresult_cv = dresult_cache_.View(13, *comp);
 
     int ncomp = result[0]->size(*comp, false);
     for (int i = 0; i != ncomp; ++i) {
-      result_v[0][i] = model_->Energy(phi_v[0][i],
-                                      phi0_v[0][i],
-                                      sl_v[0][i],
-                                      nl_v[0][i],
-                                      ul_v[0][i],
-                                      si_v[0][i],
-                                      ni_v[0][i],
-                                      ui_v[0][i],
-                                      sg_v[0][i],
-                                      ng_v[0][i],
-                                      ug_v[0][i],
-                                      rho_r_v[0][i],
-                                      ur_v[0][i],
-                                      cv_v[0][i]);
+      if (derivs) {
+        Dual<14> r = model_->Energy(Dual<14>::Variable(phi_v[0][i], 0),
+                                    Dual<14>::Variable(phi0_v[0][i], 1),
+                                    Dual<14>::Variable(sl_v[0][i], 2),
+                                    Dual<14>::Variable(nl_v[0][i], 3),
+                                    Dual<14>::Variable(ul_v[0][i], 4),
+                                    Dual<14>::Variable(si_v[0][i], 5),
+                                    Dual<14>::Variable(ni_v[0][i], 6),
+                                    Dual<14>::Variable(ui_v[0][i], 7),
+                                    Dual<14>::Variable(sg_v[0][i], 8),
+                                    Dual<14>::Variable(ng_v[0][i], 9),
+                                    Dual<14>::Variable(ug_v[0][i], 10),
+                                    Dual<14>::Variable(rho_r_v[0][i], 11),
+                                    Dual<14>::Variable(ur_v[0][i], 12),
+                                    Dual<14>::Variable(cv_v[0][i], 13));
+        result_v[0][i] = r.value();
+        if (dresult_phi) dresult_phi[i] = r.d(0);
+        if (dresult_phi0) dresult_phi0[i] = r.d(1);
+        if (dresult_sl) dresult_sl[i] = r.d(2);
+        if (dresult_nl) dresult_nl[i] = r.d(3);
+        if (dresult_ul) dresult_ul[i] = r.d(4);
+        if (dresult_si) dresult_si[i] = r.d(5);
+        if (dresult_ni) dresult_ni[i] = r.d(6);
+        if (dresult_ui) dresult_ui[i] = r.d(7);
+        if (dresult_sg) dresult_sg[i] = r.d(8);
+        if (dresult_ng) dresult_ng[i] = r.d(9);
+        if (dresult_ug) dresult_ug[i] = r.d(10);
+        if (dresult_rho_r) dresult_rho_r[i] = r.d(11);
+        if (dresult_ur) dresult_ur[i] = r.d(12);
+        if (dresult_cv) dresult_cv[i] = r.d(13);
+      } else {
+        result_v[0][i] = model_->Energy(phi_v[0][i],
+                                        phi0_v[0][i],
+                                        sl_v[0][i],
+                                        nl_v[0][i],
+                                        ul_v[0][i],
+                                        si_v[0][i],
+                                        ni_v[0][i],
+                                        ui_v[0][i],
+                                        sg_v[0][i],
+                                        ng_v[0][i],
+                                        ug_v[0][i],
+                                        rho_r_v[0][i],
+                                        ur_v[0][i],
+                                        cv_v[0][i]);
+      }
     }
   }
+  dresult_cache_.Validate();
 }
 
 
@@ -169,6 +223,7 @@ ThreePhaseEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
                                                       const Tag& wrt_tag,
                                                       const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> phi0 = S.GetPtr<CompositeVector>(phi0_key_, tag);
@@ -185,541 +240,69 @@ ThreePhaseEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
   Teuchos::RCP<const CompositeVector> ur = S.GetPtr<CompositeVector>(ur_key_, tag);
   Teuchos::RCP<const CompositeVector> cv = S.GetPtr<CompositeVector>(cv_key_, tag);
 
-  if (wrt_key == phi_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDPorosity(phi_v[0][i],
-                                                  phi0_v[0][i],
-                                                  sl_v[0][i],
-                                                  nl_v[0][i],
-                                                  ul_v[0][i],
-                                                  si_v[0][i],
-                                                  ni_v[0][i],
-                                                  ui_v[0][i],
-                                                  sg_v[0][i],
-                                                  ng_v[0][i],
-                                                  ug_v[0][i],
-                                                  rho_r_v[0][i],
-                                                  ur_v[0][i],
-                                                  cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == phi0_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDBasePorosity(phi_v[0][i],
-                                                      phi0_v[0][i],
-                                                      sl_v[0][i],
-                                                      nl_v[0][i],
-                                                      ul_v[0][i],
-                                                      si_v[0][i],
-                                                      ni_v[0][i],
-                                                      ui_v[0][i],
-                                                      sg_v[0][i],
-                                                      ng_v[0][i],
-                                                      ug_v[0][i],
-                                                      rho_r_v[0][i],
-                                                      ur_v[0][i],
-                                                      cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == sl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationLiquid(phi_v[0][i],
-                                                          phi0_v[0][i],
-                                                          sl_v[0][i],
-                                                          nl_v[0][i],
-                                                          ul_v[0][i],
-                                                          si_v[0][i],
-                                                          ni_v[0][i],
-                                                          ui_v[0][i],
-                                                          sg_v[0][i],
-                                                          ng_v[0][i],
-                                                          ug_v[0][i],
-                                                          rho_r_v[0][i],
-                                                          ur_v[0][i],
-                                                          cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == nl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityLiquid(phi_v[0][i],
-                                                            phi0_v[0][i],
-                                                            sl_v[0][i],
-                                                            nl_v[0][i],
-                                                            ul_v[0][i],
-                                                            si_v[0][i],
-                                                            ni_v[0][i],
-                                                            ui_v[0][i],
-                                                            sg_v[0][i],
-                                                            ng_v[0][i],
-                                                            ug_v[0][i],
-                                                            rho_r_v[0][i],
-                                                            ur_v[0][i],
-                                                            cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ul_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyLiquid(phi_v[0][i],
-                                                              phi0_v[0][i],
-                                                              sl_v[0][i],
-                                                              nl_v[0][i],
-                                                              ul_v[0][i],
-                                                              si_v[0][i],
-                                                              ni_v[0][i],
-                                                              ui_v[0][i],
-                                                              sg_v[0][i],
-                                                              ng_v[0][i],
-                                                              ug_v[0][i],
-                                                              rho_r_v[0][i],
-                                                              ur_v[0][i],
-                                                              cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == si_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationIce(phi_v[0][i],
-                                                       phi0_v[0][i],
-                                                       sl_v[0][i],
-                                                       nl_v[0][i],
-                                                       ul_v[0][i],
-                                                       si_v[0][i],
-                                                       ni_v[0][i],
-                                                       ui_v[0][i],
-                                                       sg_v[0][i],
-                                                       ng_v[0][i],
-                                                       ug_v[0][i],
-                                                       rho_r_v[0][i],
-                                                       ur_v[0][i],
-                                                       cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ni_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityIce(phi_v[0][i],
-                                                         phi0_v[0][i],
-                                                         sl_v[0][i],
-                                                         nl_v[0][i],
-                                                         ul_v[0][i],
-                                                         si_v[0][i],
-                                                         ni_v[0][i],
-                                                         ui_v[0][i],
-                                                         sg_v[0][i],
-                                                         ng_v[0][i],
-                                                         ug_v[0][i],
-                                                         rho_r_v[0][i],
-                                                         ur_v[0][i],
-                                                         cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ui_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyIce(phi_v[0][i],
-                                                           phi0_v[0][i],
-                                                           sl_v[0][i],
-                                                           nl_v[0][i],
-                                                           ul_v[0][i],
-                                                           si_v[0][i],
-                                                           ni_v[0][i],
-                                                           ui_v[0][i],
-                                                           sg_v[0][i],
-                                                           ng_v[0][i],
-                                                           ug_v[0][i],
-                                                           rho_r_v[0][i],
-                                                           ur_v[0][i],
-                                                           cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == sg_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationGas(phi_v[0][i],
-                                                       phi0_v[0][i],
-                                                       sl_v[0][i],
-                                                       nl_v[0][i],
-                                                       ul_v[0][i],
-                                                       si_v[0][i],
-                                                       ni_v[0][i],
-                                                       ui_v[0][i],
-                                                       sg_v[0][i],
-                                                       ng_v[0][i],
-                                                       ug_v[0][i],
-                                                       rho_r_v[0][i],
-                                                       ur_v[0][i],
-                                                       cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ng_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityGas(phi_v[0][i],
-                                                         phi0_v[0][i],
-                                                         sl_v[0][i],
-                                                         nl_v[0][i],
-                                                         ul_v[0][i],
-                                                         si_v[0][i],
-                                                         ni_v[0][i],
-                                                         ui_v[0][i],
-                                                         sg_v[0][i],
-                                                         ng_v[0][i],
-                                                         ug_v[0][i],
-                                                         rho_r_v[0][i],
-                                                         ur_v[0][i],
-                                                         cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ug_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyGas(phi_v[0][i],
-                                                           phi0_v[0][i],
-                                                           sl_v[0][i],
-                                                           nl_v[0][i],
-                                                           ul_v[0][i],
-                                                           si_v[0][i],
-                                                           ni_v[0][i],
-                                                           ui_v[0][i],
-                                                           sg_v[0][i],
-                                                           ng_v[0][i],
-                                                           ug_v[0][i],
-                                                           rho_r_v[0][i],
-                                                           ur_v[0][i],
-                                                           cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == rho_r_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDDensityRock(phi_v[0][i],
-                                                     phi0_v[0][i],
-                                                     sl_v[0][i],
-                                                     nl_v[0][i],
-                                                     ul_v[0][i],
-                                                     si_v[0][i],
-                                                     ni_v[0][i],
-                                                     ui_v[0][i],
-                                                     sg_v[0][i],
-                                                     ng_v[0][i],
-                                                     ug_v[0][i],
-                                                     rho_r_v[0][i],
-                                                     ur_v[0][i],
-                                                     cv_v[0][i]);
-      }
-    }
+  // partial derivatives computed with the value are copied
+  int wrt = -1;
+  if (wrt_key == phi_key_) wrt = 0;
+  if (wrt_key == phi0_key_) wrt = 1;
+  if (wrt_key == sl_key_) wrt = 2;
+  if (wrt_key == nl_key_) wrt = 3;
+  if (wrt_key == ul_key_) wrt = 4;
+  if (wrt_key == si_key_) wrt = 5;
+  if (wrt_key == ni_key_) wrt = 6;
+  if (wrt_key == ui_key_) wrt = 7;
+  if (wrt_key == sg_key_) wrt = 8;
+  if (wrt_key == ng_key_) wrt = 9;
+  if (wrt_key == ug_key_) wrt = 10;
+  if (wrt_key == rho_r_key_) wrt = 11;
+  if (wrt_key == ur_key_) wrt = 12;
+  if (wrt_key == cv_key_) wrt = 13;
+  if (wrt >= 0 && dresult_cache_.Has(wrt)) {
+    *result[0] = dresult_cache_.Get(wrt);
+    return;
+  }
 
-  } else if (wrt_key == ur_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyRock(phi_v[0][i],
-                                                            phi0_v[0][i],
-                                                            sl_v[0][i],
-                                                            nl_v[0][i],
-                                                            ul_v[0][i],
-                                                            si_v[0][i],
-                                                            ni_v[0][i],
-                                                            ui_v[0][i],
-                                                            sg_v[0][i],
-                                                            ng_v[0][i],
-                                                            ug_v[0][i],
-                                                            rho_r_v[0][i],
-                                                            ur_v[0][i],
-                                                            cv_v[0][i]);
-      }
-    }
+  // otherwise computed as with the value, on dual numbers, so that values do
+  // not depend on the order of requests
+  AMANZI_ASSERT(wrt >= 0);
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
+    const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
+    const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
+    const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
+    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
+    const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
+    const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
+    const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
+    const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
-  } else if (wrt_key == cv_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDCellVolume(phi_v[0][i],
-                                                    phi0_v[0][i],
-                                                    sl_v[0][i],
-                                                    nl_v[0][i],
-                                                    ul_v[0][i],
-                                                    si_v[0][i],
-                                                    ni_v[0][i],
-                                                    ui_v[0][i],
-                                                    sg_v[0][i],
-                                                    ng_v[0][i],
-                                                    ug_v[0][i],
-                                                    rho_r_v[0][i],
-                                                    ur_v[0][i],
-                                                    cv_v[0][i]);
-      }
+    int ncomp = result[0]->size(*comp, false);
+    for (int i = 0; i != ncomp; ++i) {
+      Dual<14> r = model_->Energy(Dual<14>::Variable(phi_v[0][i], 0),
+                                  Dual<14>::Variable(phi0_v[0][i], 1),
+                                  Dual<14>::Variable(sl_v[0][i], 2),
+                                  Dual<14>::Variable(nl_v[0][i], 3),
+                                  Dual<14>::Variable(ul_v[0][i], 4),
+                                  Dual<14>::Variable(si_v[0][i], 5),
+                                  Dual<14>::Variable(ni_v[0][i], 6),
+                                  Dual<14>::Variable(ui_v[0][i], 7),
+                                  Dual<14>::Variable(sg_v[0][i], 8),
+                                  Dual<14>::Variable(ng_v[0][i], 9),
+                                  Dual<14>::Variable(ug_v[0][i], 10),
+                                  Dual<14>::Variable(rho_r_v[0][i], 11),
+                                  Dual<14>::Variable(ur_v[0][i], 12),
+                                  Dual<14>::Variable(cv_v[0][i], 13));
+      result_v[0][i] = r.d(wrt);
     }
-
-  } else {
-    AMANZI_ASSERT(0);
   }
+
+  // from now on, computed with the value
+  if (wrt >= 0) dresult_cache_.Set(wrt, *result[0]);
 }
 
 
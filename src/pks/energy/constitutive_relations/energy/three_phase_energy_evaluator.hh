@@ -50,6 +50,7 @@ the larger, compressible value when used with the energy in the water.
 
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
+#include "PartialDerivativeCache.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -93,6 +94,9 @@ class ThreePhaseEnergyEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<ThreePhaseEnergyModel> model_;
 
+  // partial derivatives computed with the value
+  PartialDerivativeCache dresult_cache_;
+
  private:
   static Utils::RegisteredFactory<Evaluator, ThreePhaseEnergyEvaluator> reg_;
 };
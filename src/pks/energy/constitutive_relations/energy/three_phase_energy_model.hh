@@ -18,6 +18,8 @@ Energy for a three-phase, gas+liquid+ice evaluator.
 #ifndef AMANZI_ENERGY_THREE_PHASE_ENERGY_MODEL_HH_
 #define AMANZI_ENERGY_THREE_PHASE_ENERGY_MODEL_HH_
 
+#include <cmath>
+
 namespace Amanzi {
 namespace Energy {
 namespace Relations {
@@ -41,6 +43,27 @@ class ThreePhaseEnergyModel {
                 double ur,
                 double cv) const;
 
+  // The same, templated on the scalar type, so that evaluating on Dual
+  // numbers gives the value and all partial derivatives at once.
+  template <typename Scalar>
+  Scalar Energy(const Scalar& phi,
+                const Scalar& phi0,
+                const Scalar& sl,
+                const Scalar& nl,
+                const Scalar& ul,
+                const Scalar& si,
+                const Scalar& ni,
+                const Scalar& ui,
+                const Scalar& sg,
+                const Scalar& ng,
+                const Scalar& ug,
+                const Scalar& rho_r,
+                const Scalar& ur,
+                const Scalar& cv) const
+  {
+    return cv * (phi * (ng * sg * ug + ni * si * ui + nl * sl * ul) + rho_r * ur * (-phi0 + 1));
+  }
+
   double DEnergyDPorosity(double phi,
                           double phi0,
                           double sl,
@@ -15,6 +15,7 @@ Evaluator for enthalpy.
 
 
 #include "enthalpy_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -51,6 +52,7 @@ EnthalpyEvaluator::Clone() const
 void
 EnthalpyEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Teuchos::OSTab tab = vo_.getOSTab();
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> u_l = S.GetPtr<CompositeVector>(ie_key_, tag);
@@ -82,6 +84,7 @@ EnthalpyEvaluator::EvaluatePartialDerivative_(const State& S,
                                               const Tag& wrt_tag,
                                               const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   // not implemented
   if (wrt_key == ie_key_) {
@@ -14,6 +14,7 @@
 
 #include "iem_evaluator.hh"
 #include "iem_factory.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -60,6 +61,7 @@ IEMEvaluator::InitializeFromPlist_()
 void
 IEMEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> temp = S.GetPtr<CompositeVector>(temp_key_, tag);
 
@@ -79,6 +81,7 @@ IEMEvaluator::EvaluatePartialDerivative_(const State& S,
                                          const Tag& wrt_tag,
                                          const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(wrt_key == temp_key_);
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> temp = S.GetPtr<CompositeVector>(temp_key_, tag);
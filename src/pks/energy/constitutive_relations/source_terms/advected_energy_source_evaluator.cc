@@ -13,6 +13,7 @@
 */
 
 #include "advected_energy_source_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -35,6 +36,7 @@ void
 AdvectedEnergySourceEvaluator::Evaluate_(const State& S,
                                          const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   const Epetra_MultiVector& int_enth =
     *S.GetPtr<CompositeVector>(internal_enthalpy_key_, tag)->ViewComponent("cell", false);
@@ -98,6 +100,7 @@ AdvectedEnergySourceEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   if (include_conduction_ && wrt_key == conducted_source_key_) {
     *result[0]->ViewComponent("cell", false) =
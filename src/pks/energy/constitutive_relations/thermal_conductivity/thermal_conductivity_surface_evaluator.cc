@@ -13,6 +13,7 @@
 */
 
 #include "thermal_conductivity_surface_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -46,6 +47,7 @@ void
 ThermalConductivitySurfaceEvaluator::Evaluate_(const State& S,
                                                const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   // pull out the dependencies
   Teuchos::RCP<const CompositeVector> eta = S.GetPtr<CompositeVector>(uf_key_, tag);
@@ -75,6 +77,7 @@ ThermalConductivitySurfaceEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   std::cout << "THERMAL CONDUCITIVITY: Derivative not implemented yet!" << wrt_key << "\n";
   AMANZI_ASSERT(0);        // not implemented, not yet needed
   result[0]->Scale(1.e-6); // convert to MJ
@@ -16,6 +16,7 @@
 #include "dbc.hh"
 #include "thermal_conductivity_threephase_factory.hh"
 #include "thermal_conductivity_threephase_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -73,6 +74,7 @@ void
 ThermalConductivityThreePhaseEvaluator::Evaluate_(const State& S,
                                                   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
 
   // pull out the dependencies
@@ -122,6 +124,7 @@ ThermalConductivityThreePhaseEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
 
   // pull out the dependencies
@@ -15,6 +15,7 @@
 #include "dbc.hh"
 #include "thermal_conductivity_twophase_factory.hh"
 #include "thermal_conductivity_twophase_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -63,6 +64,7 @@ void
 ThermalConductivityTwoPhaseEvaluator::Evaluate_(const State& S,
                                                 const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
 
   // pull out the dependencies
@@ -107,6 +109,7 @@ ThermalConductivityTwoPhaseEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // not yet implemented in underlying models!
   result[0]->PutScalar(0.);
   // result[0]->Scale(1.e-6); // convert to MJ
@@ -23,6 +23,7 @@
 #include "CompositeVectorFunction.hh"
 #include "CompositeVectorFunctionFactory.hh"
 #include "pk_helpers.hh"
+#include "reductions.hh"
 #include "MeshAlgorithms.hh"
 
 #include "energy_base.hh"
@@ -622,18 +623,11 @@ EnergyBase::UpdateBoundaryConditions_(const Tag& tag)
   }
 
   // mark all remaining boundary conditions as zero diffusive flux conditions
-  int nfaces_owned =
-    mesh_->getNumEntities(AmanziMesh::Entity_kind::FACE, AmanziMesh::Parallel_kind::OWNED);
-  for (int f = 0; f < nfaces_owned; f++) {
+  for (auto f : BoundaryFaces_()) {
     if (markers[f] == Operators::OPERATOR_BC_NONE) {
-      auto cells = mesh_->getFaceCells(f);
-      int ncells = cells.size();
-
-      if (ncells == 1) {
-        markers[f] = Operators::OPERATOR_BC_NEUMANN;
-        values[f] = 0.0;
-        adv_markers[f] = Operators::OPERATOR_BC_DIRICHLET;
-      }
+      markers[f] = Operators::OPERATOR_BC_NEUMANN;
+      values[f] = 0.0;
+      adv_markers[f] = Operators::OPERATOR_BC_DIRICHLET;
     }
   }
 
@@ -693,10 +687,12 @@ EnergyBase::IsAdmissible(Teuchos::RCP<const TreeVector> up)
     maxT = maxT_c;
   }
 
-  double minT_l = minT;
-  double maxT_l = maxT;
-  mesh_->getComm()->MaxAll(&maxT_l, &maxT, 1);
-  mesh_->getComm()->MinAll(&minT_l, &minT, 1);
+  Reductions reductions(mesh_->getComm());
+  int min_handle = reductions.Min(minT);
+  int max_handle = reductions.Max(maxT);
+  reductions.Reduce();
+  minT = reductions[min_handle];
+  maxT = reductions[max_handle];
 
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
     *vo_->os() << "    Admissible T? (min/max): " << minT << ",  " << maxT << std::endl;
@@ -899,9 +895,9 @@ EnergyBase::ModifyCorrection(double h,
          ++comp) {
       Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
 
-      double max;
-      du_c.NormInf(&max);
       if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+        double max;
+        du_c.NormInf(&max);
         *vo_->os() << "Max temperature correction (" << *comp << ") = " << max << std::endl;
       }
 
@@ -12,6 +12,7 @@
 #include "Evaluator.hh"
 #include "energy_base.hh"
 #include "Op.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -30,6 +31,7 @@ EnergyBase::FunctionalResidual(double t_old,
                                Teuchos::RCP<TreeVector> u_new,
                                Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
   Teuchos::OSTab tab = vo_->getOSTab();
 
   // increment, get timestep
@@ -116,6 +118,7 @@ EnergyBase::FunctionalResidual(double t_old,
 int
 EnergyBase::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
 #if DEBUG_FLAG
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon application:" << std::endl;
@@ -139,6 +142,7 @@ EnergyBase::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<T
 void
 EnergyBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
@@ -282,13 +286,9 @@ EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeV
 
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_->get_time(tag_next_) - S_->get_time(tag_current_);
+  bool verbose = vo_->os_OK(Teuchos::VERB_MEDIUM);
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->getComm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
-
-  double enorm_val = 0.0;
+  std::vector<ENorm_t> enorms;
   for (CompositeVector::name_iterator comp = dvec->begin(); comp != dvec->end(); ++comp) {
     double enorm_comp = 0.0;
     int enorm_loc = -1;
@@ -299,73 +299,68 @@ EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeV
       // energy since it doesn't make much sense to be relative to
       // energy
       int ncells = dvec->size(*comp, false);
-      for (unsigned int c = 0; c != ncells; ++c) {
+      auto enorm_c = [&](int c) {
         double mass = std::max(mass_atol_, wc[0][c] / cv[0][c]);
         double energy = mass * atol_ + soil_atol_;
-        double enorm_c = std::abs(h * dvec_v[0][c]) / (energy * cv[0][c]);
-
-        if (enorm_c > enorm_comp) {
-          enorm_comp = enorm_c;
-          enorm_loc = c;
+        return std::abs(h * dvec_v[0][c]) / (energy * cv[0][c]);
+      };
+
+      // the location of the maximum is only needed for output, and the
+      // maximum alone vectorizes
+      if (verbose) {
+        for (int c = 0; c != ncells; ++c) {
+          double enorm_c_val = enorm_c(c);
+          if (enorm_c_val > enorm_comp) {
+            enorm_comp = enorm_c_val;
+            enorm_loc = c;
+          }
         }
+      } else {
+        for (int c = 0; c != ncells; ++c) enorm_comp = std::max(enorm_comp, enorm_c(c));
       }
 
     } else if (*comp == std::string("face")) {
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
-
-      for (unsigned int f = 0; f != nfaces; ++f) {
-        auto cells = mesh_->getFaceCells(f);
-        double cv_min =
-          cells.size() == 1 ? cv[0][cells[0]] : std::min(cv[0][cells[0]], cv[0][cells[1]]);
-        double mass_min = cells.size() == 1 ? wc[0][cells[0]] / cv[0][cells[0]] :
-                                              std::min(wc[0][cells[0]] / cv[0][cells[0]],
-                                                       wc[0][cells[1]] / cv[0][cells[1]]);
+      const auto& face_cells = FaceCells_();
+      auto enorm_f = [&](int f) {
+        int c0 = face_cells[2 * f];
+        int c1 = face_cells[2 * f + 1];
+        double cv_min = std::min(cv[0][c0], cv[0][c1]);
+        double mass_min = std::min(wc[0][c0] / cv[0][c0], wc[0][c1] / cv[0][c1]);
         mass_min = std::max(mass_min, mass_atol_);
 
         double energy = mass_min * atol_ + soil_atol_;
-        double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f]) / (energy * cv_min);
-
-        if (enorm_f > enorm_comp) {
-          enorm_comp = enorm_f;
-          enorm_loc = f;
+        return fluxtol_ * h * std::abs(dvec_v[0][f]) / (energy * cv_min);
+      };
+
+      if (verbose) {
+        for (int f = 0; f != nfaces; ++f) {
+          double enorm_f_val = enorm_f(f);
+          if (enorm_f_val > enorm_comp) {
+            enorm_comp = enorm_f_val;
+            enorm_loc = f;
+          }
         }
+      } else {
+        for (int f = 0; f != nfaces; ++f) enorm_comp = std::max(enorm_comp, enorm_f(f));
       }
 
     } else {
-      // boundary face components had better be effectively identically 0
-      double norm;
-      dvec_v.Norm2(&norm);
-      AMANZI_ASSERT(norm < 1.e-15);
+      // boundary face components had better be effectively identically 0,
+      // checked locally to avoid a collective call
+      double norm2 = 0.;
+      for (int i = 0; i != dvec_v.MyLength(); ++i) norm2 += dvec_v[0][i] * dvec_v[0][i];
+      AMANZI_ASSERT(std::sqrt(norm2) < 1.e-15);
     }
 
-
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
-
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
-
-      int ierr;
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] ("
-                 << infnorm << ")" << std::endl;
-    }
-
-    enorm_val = std::max(enorm_val, enorm_comp);
+    ENorm_t enorm;
+    enorm.value = enorm_comp;
+    enorm.gid = dvec_v.Map().GID(enorm_loc);
+    enorms.push_back(enorm);
   }
 
-  double enorm_val_l = enorm_val;
-
-  int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
-  AMANZI_ASSERT(!ierr);
-  return enorm_val;
+  return ReduceErrorNorm_(*dvec, enorms);
 };
 
 
@@ -19,6 +19,7 @@ de/dt + q dot grad h = div Ke grad T + S?
 #include "EvaluatorPrimary.hh"
 #include "Op.hh"
 #include "energy_interfrost.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -72,6 +73,7 @@ InterfrostEnergy::AddAccumulation_(const Teuchos::Ptr<CompositeVector>& g)
 void
 InterfrostEnergy::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
@@ -0,0 +1,90 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  The three phase energy model evaluated on dual numbers, whose partial
+  derivatives must match the sympy-generated methods.
+*/
+
+#include <cmath>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "Dual.hh"
+#include "three_phase_energy_model.hh"
+
+using namespace Amanzi;
+using namespace Amanzi::Energy::Relations;
+
+
+TEST(THREE_PHASE_ENERGY_DUAL_MATCHES_SYMPY)
+{
+  Teuchos::ParameterList plist;
+  ThreePhaseEnergyModel model(plist);
+
+  using Deriv = double (ThreePhaseEnergyModel::*)(double,
+                                                  double,
+                                                  double,
+                                                  double,
+                                                  double,
+                                                  double,
+                                                  double,
+                                                  double,
+                                                  double,
+                                                  double,
+                                                  double,
+                                                  double,
+                                                  double,
+                                                  double) const;
+  const Deriv derivs[14] = { &ThreePhaseEnergyModel::DEnergyDPorosity,
+                             &ThreePhaseEnergyModel::DEnergyDBasePorosity,
+                             &ThreePhaseEnergyModel::DEnergyDSaturationLiquid,
+                             &ThreePhaseEnergyModel::DEnergyDMolarDensityLiquid,
+                             &ThreePhaseEnergyModel::DEnergyDInternalEnergyLiquid,
+                             &ThreePhaseEnergyModel::DEnergyDSaturationIce,
+                             &ThreePhaseEnergyModel::DEnergyDMolarDensityIce,
+                             &ThreePhaseEnergyModel::DEnergyDInternalEnergyIce,
+                             &ThreePhaseEnergyModel::DEnergyDSaturationGas,
+                             &ThreePhaseEnergyModel::DEnergyDMolarDensityGas,
+                             &ThreePhaseEnergyModel::DEnergyDInternalEnergyGas,
+                             &ThreePhaseEnergyModel::DEnergyDDensityRock,
+                             &ThreePhaseEnergyModel::DEnergyDInternalEnergyRock,
+                             &ThreePhaseEnergyModel::DEnergyDCellVolume };
+
+  for (int k = 0; k != 5; ++k) {
+    double x[14] = { 0.2 + 0.1 * k, 0.25,     0.5 - 0.1 * k, 55000., 1.e3 * k, 0.1 * k, 50000.,
+                     -6.e3,         0.5,      40. + k,       2.e3,   2700.,    1.e3 - k, 2.5 };
+    Dual<14> xd[14];
+    for (int i = 0; i != 14; ++i) xd[i] = Dual<14>::Variable(x[i], i);
+    Dual<14> r = model.Energy(xd[0],
+                              xd[1],
+                              xd[2],
+                              xd[3],
+                              xd[4],
+                              xd[5],
+                              xd[6],
+                              xd[7],
+                              xd[8],
+                              xd[9],
+                              xd[10],
+                              xd[11],
+                              xd[12],
+                              xd[13]);
+
+    double value = model.Energy(
+      x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8], x[9], x[10], x[11], x[12], x[13]);
+    CHECK_CLOSE(value, r.value(), 1.e-12 * std::abs(value));
+    for (int i = 0; i != 14; ++i) {
+      double d = (model.*derivs[i])(
+        x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8], x[9], x[10], x[11], x[12], x[13]);
+      CHECK_CLOSE(d, r.d(i), 1.e-12 * std::abs(d) + 1.e-12);
+    }
+  }
+}
@@ -14,6 +14,7 @@
 
 #include "effective_height_model.hh"
 #include "effective_height_evaluator.hh"
+#include "ProfileTimer.hh"
 
 
 namespace Amanzi {
@@ -44,6 +45,7 @@ EffectiveHeightEvaluator::Clone() const
 void
 EffectiveHeightEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> height = S.GetPtr<CompositeVector>(height_key_, tag);
 
@@ -66,6 +68,7 @@ EffectiveHeightEvaluator::EvaluatePartialDerivative_(const State& S,
                                                      const Tag& wrt_tag,
                                                      const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(wrt_key == height_key_);
 
   // Pull dependencies out of state.
@@ -13,6 +13,8 @@
 */
 
 #include "elevation_evaluator.hh"
+#include "BoundaryFaceMap.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -43,18 +45,27 @@ ElevationEvaluator::ElevationEvaluator(Teuchos::ParameterList& plist)
 }
 
 
+// Structure is the same for all keys; boundary faces need the map of the mesh.
+void
+ElevationEvaluator::EnsureCompatibility_Structure_(State& S)
+{
+  EnsureCompatibility_StructureSame_(S);
+  Relations::requireBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first));
+}
+
+
 void
 ElevationEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   EvaluateElevationAndSlope_(S, results);
 
   // If boundary faces are requested, grab the slopes on the internal cell
   CompositeVector* slope = results[1];
 
   if (slope->HasComponent("boundary_face")) {
-    const Epetra_Map& vandelay_map =
-      slope->Mesh()->getMap(AmanziMesh::Entity_kind::BOUNDARY_FACE, false);
-    const Epetra_Map& face_map = slope->Mesh()->getMap(AmanziMesh::Entity_kind::FACE, false);
+    const auto& bf_cell =
+      Relations::getBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first)).cell;
     Epetra_MultiVector& slope_bf = *slope->ViewComponent("boundary_face", false);
     const Epetra_MultiVector& slope_c = *slope->ViewComponent("cell", false);
 
@@ -62,11 +73,9 @@ ElevationEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*
     int nbfaces = slope_bf.MyLength();
     for (int bf = 0; bf != nbfaces; ++bf) {
       // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      auto cells = slope->Mesh()->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
+      AmanziMesh::Entity_ID c = bf_cell[bf];
 
-      slope_bf[0][bf] = slope_c[0][cells[0]];
+      slope_bf[0][bf] = slope_c[0][c];
     }
   }
 }
@@ -78,6 +87,7 @@ ElevationEvaluator::EvaluatePartialDerivative_(const State& S,
                                                const Tag& wrt_tag,
                                                const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(0);
 }
 
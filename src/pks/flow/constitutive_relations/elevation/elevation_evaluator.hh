@@ -48,10 +48,7 @@ class ElevationEvaluator : public EvaluatorSecondaryMonotypeCV {
   // common structure.  Often, aspect is not used and so it can otherwise be an
   // empty vector with no structure, which causes seg faults.
   //
-  virtual void EnsureCompatibility_Structure_(State& S) override
-  {
-    EnsureCompatibility_StructureSame_(S);
-  }
+  virtual void EnsureCompatibility_Structure_(State& S) override;
 
 
  protected:
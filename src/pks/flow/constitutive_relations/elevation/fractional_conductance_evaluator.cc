@@ -10,6 +10,7 @@
 #include "MeshAlgorithms.hh"
 #include "fractional_conductance_evaluator.hh"
 #include "subgrid_microtopography.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -50,6 +51,7 @@ void
 FractionalConductanceEvaluator::Evaluate_(const State& S,
                                           const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> vpd_v = S.GetPtr<CompositeVector>(vpd_key_, tag);
   Teuchos::RCP<const CompositeVector> del_max_v = S.GetPtr<CompositeVector>(delta_max_key_, tag);
@@ -95,6 +97,7 @@ FractionalConductanceEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> vpd_v = S.GetPtr<CompositeVector>(vpd_key_, tag);
   Teuchos::RCP<const CompositeVector> del_max_v = S.GetPtr<CompositeVector>(delta_max_key_, tag);
@@ -14,6 +14,7 @@
 
 #include "height_model.hh"
 #include "height_evaluator.hh"
+#include "ProfileTimer.hh"
 
 
 namespace Amanzi {
@@ -65,6 +66,7 @@ HeightEvaluator::EnsureCompatibility_ToDeps_(State& S)
 void
 HeightEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> pres = S.GetPtr<CompositeVector>(pres_key_, tag);
 
@@ -103,6 +105,7 @@ HeightEvaluator::EvaluatePartialDerivative_(const State& S,
                                             const Tag& wrt_tag,
                                             const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
 
   // -- cells need the function eval
@@ -14,6 +14,7 @@
 
 #include "icy_height_model.hh"
 #include "icy_height_evaluator.hh"
+#include "ProfileTimer.hh"
 
 
 namespace Amanzi {
@@ -48,6 +49,7 @@ IcyHeightEvaluator::Clone() const
 void
 IcyHeightEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> pres = S.GetPtr<CompositeVector>(pres_key_, tag);
 
@@ -94,6 +96,7 @@ IcyHeightEvaluator::EvaluatePartialDerivative_(const State& S,
                                                const Tag& wrt_tag,
                                                const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // this is rather hacky.  surface_pressure is a mixed field vector -- it has
   // pressure on cells and ponded depth on faces.
   // -- NO FACE DERIVATIVES
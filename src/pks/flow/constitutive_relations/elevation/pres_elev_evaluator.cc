@@ -13,6 +13,7 @@
 */
 
 #include "pres_elev_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -40,6 +41,7 @@ PresElevEvaluator::Clone() const
 void
 PresElevEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
 
   // update pressure + elevation
@@ -56,6 +58,7 @@ PresElevEvaluator::EvaluatePartialDerivative_(const State& S,
                                               const Tag& wrt_tag,
                                               const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   result[0]->PutScalar(1.0);
 }
 
@@ -13,6 +13,7 @@
 */
 
 #include "snow_skin_potential_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -51,6 +52,7 @@ SnowSkinPotentialEvaluator::Clone() const
 void
 SnowSkinPotentialEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   // update pressure + elevation
   Teuchos::RCP<const CompositeVector> pd = S.GetPtr<CompositeVector>(pd_key_, tag);
@@ -76,6 +78,7 @@ SnowSkinPotentialEvaluator::EvaluatePartialDerivative_(const State& S,
                                                        const Tag& wrt_tag,
                                                        const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(0);
   result[0]->PutScalar(1.0);
 }
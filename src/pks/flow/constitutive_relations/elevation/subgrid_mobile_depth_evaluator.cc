@@ -9,6 +9,7 @@
 
 #include "MeshAlgorithms.hh"
 #include "subgrid_mobile_depth_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -38,6 +39,7 @@ SubgridMobileDepthEvaluator::Clone() const
 void
 SubgridMobileDepthEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   auto depr_depth_v = S.GetPtr<CompositeVector>(depr_depth_key_, tag);
   auto depth_v = S.GetPtr<CompositeVector>(depth_key_, tag);
@@ -67,6 +69,7 @@ SubgridMobileDepthEvaluator::EvaluatePartialDerivative_(const State& S,
                                                         const Tag& wrt_tag,
                                                         const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   auto depr_depth_v = S.GetPtr<CompositeVector>(depr_depth_key_, tag);
   auto depth_v = S.GetPtr<CompositeVector>(depth_key_, tag);
@@ -23,6 +23,7 @@
 #include "MeshAlgorithms.hh"
 #include "volumetric_ponded_depth_evaluator.hh"
 #include "subgrid_microtopography.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -50,6 +51,7 @@ void
 VolumetricPondedDepthEvaluator::Evaluate_(const State& S,
                                           const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   // NOTE, we can only differentiate with respect to quantities that exist on
   // all entities, not just cell entities.
   Tag tag = my_keys_.front().second;
@@ -85,6 +87,7 @@ VolumetricPondedDepthEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> pd_v = S.GetPtr<CompositeVector>(pd_key_, tag);
   Teuchos::RCP<const CompositeVector> del_max_v = S.GetPtr<CompositeVector>(delta_max_key_, tag);
@@ -25,6 +25,7 @@
 #include "MeshAlgorithms.hh"
 #include "volumetric_snow_ponded_depth_evaluator.hh"
 #include "subgrid_microtopography.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -75,6 +76,7 @@ void
 VolumetricSnowPondedDepthEvaluator::Evaluate_(const State& S,
                                               const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   // NOTE, we can only differentiate with respect to quantities that exist on
   // all entities, not just cell entities.
   Tag tag = my_keys_.front().second;
@@ -134,6 +136,7 @@ VolumetricSnowPondedDepthEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   // NOTE, we can only differentiate with respect to quantities that exist on
   // all entities, not just cell entities.
@@ -16,6 +16,7 @@
 
 #include "height_model.hh"
 #include "water_level_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -60,6 +61,7 @@ WaterLevelEvaluator::Clone() const
 void
 WaterLevelEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> pres = S.GetPtr<CompositeVector>(pres_key_, tag);
 
@@ -119,6 +121,7 @@ WaterLevelEvaluator::EvaluatePartialDerivative_(const State& S,
                                                 const Tag& wrt_tag,
                                                 const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
 
   // -- cells need the function eval for ponded depth
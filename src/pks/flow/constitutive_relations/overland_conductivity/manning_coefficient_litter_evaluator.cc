@@ -17,6 +17,8 @@
 #include "manning_coefficient_litter_model.hh"
 #include "manning_coefficient_litter_constant_model.hh"
 #include "manning_coefficient_litter_variable_model.hh"
+#include "BoundaryFaceMap.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -62,10 +64,20 @@ ManningCoefficientLitterEvaluator::InitializeFromPlist_()
 }
 
 
+// Boundary faces need the map of the mesh.
+void
+ManningCoefficientLitterEvaluator::EnsureCompatibility_ToDeps_(State& S)
+{
+  EvaluatorSecondaryMonotypeCV::EnsureCompatibility_ToDeps_(S);
+  Relations::requireBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first));
+}
+
+
 void
 ManningCoefficientLitterEvaluator::Evaluate_(const State& S,
                                              const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   // Initialize the MeshPartition
   if (!models_->first->initialized()) {
     models_->first->Initialize(result[0]->Mesh(), -1);
@@ -96,18 +108,15 @@ ManningCoefficientLitterEvaluator::Evaluate_(const State& S,
     Epetra_MultiVector& result_v = *result[0]->ViewComponent("boundary_face", false);
 
     // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = result[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->getMap(AmanziMesh::Entity_kind::BOUNDARY_FACE, false);
-    const Epetra_Map& face_map = mesh->getMap(AmanziMesh::Entity_kind::FACE, false);
+    const auto& bf_cell =
+      Relations::getBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first)).cell;
 
     int ncomp = result[0]->size("boundary_face", false);
     for (int bf = 0; bf != ncomp; ++bf) {
       // given a boundary face, we need the internal cell to choose the right model
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      auto cells = mesh->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
+      AmanziMesh::Entity_ID c = bf_cell[bf];
 
-      int index = (*models_->first)[cells[0]];
+      int index = (*models_->first)[c];
       result_v[0][bf] = models_->second[index]->ManningCoefficient(ld_v[0][bf], pd_v[0][bf]);
     }
   }
@@ -121,6 +130,7 @@ ManningCoefficientLitterEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // Initialize the MeshPartition
   if (!models_->first->initialized()) {
     models_->first->Initialize(result[0]->Mesh(), -1);
@@ -160,19 +170,16 @@ ManningCoefficientLitterEvaluator::EvaluatePartialDerivative_(
     Epetra_MultiVector& result_v = *result[0]->ViewComponent("boundary_face", false);
 
     // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = result[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->getMap(AmanziMesh::Entity_kind::BOUNDARY_FACE, false);
-    const Epetra_Map& face_map = mesh->getMap(AmanziMesh::Entity_kind::FACE, false);
+    const auto& bf_cell =
+      Relations::getBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first)).cell;
 
     int ncomp = result[0]->size("boundary_face", false);
     if (wrt_key == ld_key_) {
       for (int bf = 0; bf != ncomp; ++bf) {
         // given a boundary face, we need the internal cell to choose the right model
-        AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-        auto cells = mesh->getFaceCells(f);
-        AMANZI_ASSERT(cells.size() == 1);
+        AmanziMesh::Entity_ID c = bf_cell[bf];
 
-        int index = (*models_->first)[cells[0]];
+        int index = (*models_->first)[c];
         result_v[0][bf] =
           models_->second[index]->DManningCoefficientDLitterThickness(ld_v[0][bf], pd_v[0][bf]);
       }
@@ -180,11 +187,9 @@ ManningCoefficientLitterEvaluator::EvaluatePartialDerivative_(
     } else if (wrt_key == pd_key_) {
       for (int bf = 0; bf != ncomp; ++bf) {
         // given a boundary face, we need the internal cell to choose the right model
-        AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-        auto cells = mesh->getFaceCells(f);
-        AMANZI_ASSERT(cells.size() == 1);
+        AmanziMesh::Entity_ID c = bf_cell[bf];
 
-        int index = (*models_->first)[cells[0]];
+        int index = (*models_->first)[c];
         result_v[0][bf] =
           models_->second[index]->DManningCoefficientDPondedDepth(ld_v[0][bf], pd_v[0][bf]);
       }
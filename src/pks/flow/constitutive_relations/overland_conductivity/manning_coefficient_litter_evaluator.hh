@@ -54,6 +54,8 @@ class ManningCoefficientLitterEvaluator : public EvaluatorSecondaryMonotypeCV {
                                           const Tag& wrt_tag,
                                           const std::vector<CompositeVector*>& result) override;
 
+  virtual void EnsureCompatibility_ToDeps_(State& S) override;
+
   void InitializeFromPlist_();
 
  protected:
@@ -15,6 +15,7 @@
 #include "MeshAlgorithms.hh"
 #include "overland_conductivity_evaluator.hh"
 #include "manning_conductivity_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -74,6 +75,7 @@ void
 OverlandConductivityEvaluator::Evaluate_(const State& S,
                                          const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> depth = S.GetPtr<CompositeVector>(mobile_depth_key_, tag);
   Teuchos::RCP<const CompositeVector> slope = S.GetPtr<CompositeVector>(slope_key_, tag);
@@ -137,6 +139,7 @@ OverlandConductivityEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // NOTE, we can only differentiate with respect to quantities that exist on
   // all entities, not just cell entities.
   Tag tag = my_keys_.front().second;
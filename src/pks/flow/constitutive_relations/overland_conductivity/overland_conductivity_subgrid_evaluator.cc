@@ -15,6 +15,7 @@
 #include "MeshAlgorithms.hh"
 #include "overland_conductivity_subgrid_evaluator.hh"
 #include "manning_conductivity_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -72,6 +73,7 @@ void
 OverlandConductivitySubgridEvaluator::Evaluate_(const State& S,
                                                 const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> mobile_depth =
     S.GetPtr<CompositeVector>(mobile_depth_key_, tag);
@@ -130,6 +132,7 @@ OverlandConductivitySubgridEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> mobile_depth =
     S.GetPtr<CompositeVector>(mobile_depth_key_, tag);
@@ -14,6 +14,7 @@
 
 #include "surface_relperm_evaluator.hh"
 #include "surface_relperm_model_factory.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -52,6 +53,7 @@ SurfaceRelPermEvaluator::Clone() const
 void
 SurfaceRelPermEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   if (is_temp_) {
     Teuchos::RCP<const CompositeVector> uf = S.GetPtr<CompositeVector>(uf_key_, tag);
@@ -90,6 +92,7 @@ SurfaceRelPermEvaluator::EvaluatePartialDerivative_(const State& S,
                                                     const Tag& wrt_tag,
                                                     const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(0);
 }
 
@@ -14,6 +14,7 @@
 
 #include "compressible_porosity_evaluator.hh"
 #include "compressible_porosity_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -46,6 +47,7 @@ void
 CompressiblePorosityEvaluator::Evaluate_(const State& S,
                                          const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   // Initialize the MeshPartition
   if (!models_->first->initialized()) {
@@ -82,6 +84,7 @@ CompressiblePorosityEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // Initialize the MeshPartition
   if (!models_->first->initialized()) {
     models_->first->Initialize(result[0]->Mesh(), -1);
@@ -14,6 +14,7 @@
 
 #include "compressible_porosity_leijnse_evaluator.hh"
 #include "compressible_porosity_leijnse_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -48,6 +49,7 @@ void
 CompressiblePorosityLeijnseEvaluator::Evaluate_(const State& S,
                                                 const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   // Initialize the MeshPartition
   if (!models_->first->initialized()) {
     models_->first->Initialize(result[0]->Mesh(), -1);
@@ -84,6 +86,7 @@ CompressiblePorosityLeijnseEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // Initialize the MeshPartition
   if (!models_->first->initialized()) {
     models_->first->Initialize(result[0]->Mesh(), -1);
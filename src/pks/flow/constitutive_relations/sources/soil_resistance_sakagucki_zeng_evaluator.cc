@@ -17,6 +17,7 @@
 #include "MeshAlgorithms.hh"
 #include "soil_resistance_sakagucki_zeng_evaluator.hh"
 #include "soil_resistance_sakagucki_zeng_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -52,6 +53,7 @@ void
 SoilResistanceSakaguckiZengEvaluator::Evaluate_(const State& S,
                                                 const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   // Initialize the MeshPartition
   if (!models_->first->initialized()) {
@@ -89,6 +91,7 @@ SoilResistanceSakaguckiZengEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // Initialize the MeshPartition
   if (!models_->first->initialized()) {
     models_->first->Initialize(result[0]->Mesh(), -1);
@@ -16,6 +16,7 @@
 
 #include "MeshAlgorithms.hh"
 #include "soil_resistance_sellers_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -45,6 +46,7 @@ void
 SoilResistanceSellersEvaluator::Evaluate_(const State& S,
                                           const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> sat = S.GetPtr<CompositeVector>(sat_key_, tag);
   Teuchos::RCP<const AmanziMesh::Mesh> mesh = sat->Mesh();
@@ -73,6 +75,7 @@ SoilResistanceSellersEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> sat = S.GetPtr<CompositeVector>(sat_key_, tag);
   Teuchos::RCP<const AmanziMesh::Mesh> mesh = sat->Mesh();
@@ -19,6 +19,7 @@ it needs a special evaluator.
 
 
 #include "interfrost_water_content.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -49,6 +50,7 @@ InterfrostWaterContent::Clone() const
 void
 InterfrostWaterContent::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   const Epetra_MultiVector& s_l =
     *S.Get<CompositeVector>("saturation_liquid", tag).ViewComponent("cell", false);
@@ -83,6 +85,7 @@ InterfrostWaterContent::EvaluatePartialDerivative_(const State& S,
                                                    const Tag& wrt_tag,
                                                    const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   const Epetra_MultiVector& s_l =
     *S.Get<CompositeVector>("saturation_liquid", tag).ViewComponent("cell", false);
@@ -13,6 +13,7 @@
 */
 
 #include "overland_pressure_multicomponent_water_content_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -54,6 +55,7 @@ OverlandPressureMulticomponentWaterContentEvaluator::Evaluate_(
   const State& S,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Epetra_MultiVector& res = *result[0]->ViewComponent("cell", false);
   const Epetra_MultiVector& pres =
@@ -101,6 +103,7 @@ OverlandPressureMulticomponentWaterContentEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   AMANZI_ASSERT(wrt_key == pres_key_);
 
@@ -13,6 +13,7 @@
 */
 
 #include "overland_pressure_water_content_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -48,6 +49,7 @@ void
 OverlandPressureWaterContentEvaluator::Evaluate_(const State& S,
                                                  const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Epetra_MultiVector& res = *result[0]->ViewComponent("cell", false);
   const Epetra_MultiVector& pres =
@@ -86,6 +88,7 @@ OverlandPressureWaterContentEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   AMANZI_ASSERT(wrt_key == pres_key_);
 
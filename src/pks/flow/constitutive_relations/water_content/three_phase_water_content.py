@@ -22,4 +22,4 @@ expression = phi*(sl*nl + si*ni + sg*ng*omega)*cv;
 
 generate_evaluator("three_phase_water_content", "Flow",
                    "three phase water content", "water_content",
-                   deps, params, expression=expression, doc=__doc__)
+                   deps, params, expression=expression, doc=__doc__, ad=True)
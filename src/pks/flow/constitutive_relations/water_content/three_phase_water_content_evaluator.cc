@@ -15,6 +15,8 @@ Water content for a three-phase, gas+liquid+ice evaluator.
 
 #include "three_phase_water_content_evaluator.hh"
 #include "three_phase_water_content_model.hh"
+#include "Dual.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -22,7 +24,7 @@ namespace Relations {
 
 // Constructor from ParameterList
 ThreePhaseWaterContentEvaluator::ThreePhaseWaterContentEvaluator(Teuchos::ParameterList& plist)
-  : EvaluatorSecondaryMonotypeCV(plist)
+  : EvaluatorSecondaryMonotypeCV(plist), dresult_cache_(9)
 {
   Teuchos::ParameterList& sublist = plist_.sublist("three_phase_water_content parameters");
   model_ = Teuchos::rcp(new ThreePhaseWaterContentModel(sublist));
@@ -90,6 +92,7 @@ void
 ThreePhaseWaterContentEvaluator::Evaluate_(const State& S,
                                            const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> sl = S.GetPtr<CompositeVector>(sl_key_, tag);
@@ -101,6 +104,10 @@ ThreePhaseWaterContentEvaluator::Evaluate_(const State& S,
   Teuchos::RCP<const CompositeVector> omega = S.GetPtr<CompositeVector>(omega_key_, tag);
   Teuchos::RCP<const CompositeVector> cv = S.GetPtr<CompositeVector>(cv_key_, tag);
 
+  // partial derivatives that have been requested are computed in the same
+  // sweep as the value, all at once by evaluating the model on dual numbers
+  dresult_cache_.Invalidate();
+  bool derivs = !dresult_cache_.Empty();
   for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
     const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
     const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
@@ -112,20 +119,52 @@ ThreePhaseWaterContentEvaluator::Evaluate_(const State& S,
     const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
     const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+    double* dresult_phi = dresult_cache_.View(0, *comp);
+    double* dresult_sl = dresult_cache_.View(1, *comp);
+    double* dresult_nl = dresult_cache_.View(2, *comp);
+    double* dresult_si = dresult_cache_.View(3, *comp);
+    double* dresult_ni = dresult_cache_.View(4, *comp);
+    double* dresult_sg = dresult_cache_.View(5, *comp);
+    double* dresult_ng = dresult_cache_.View(6, *comp);
+    double* dresult_omega = dresult_cache_.View(7, *comp);
+    double* dresult_cv = dresult_cache_.View(8, *comp);
 
     int ncomp = result[0]->size(*comp, false);
     for (int i = 0; i != ncomp; ++i) {
-      result_v[0][i] = model_->WaterContent(phi_v[0][i],
-                                            sl_v[0][i],
-                                            nl_v[0][i],
-                                            si_v[0][i],
-                                            ni_v[0][i],
-                                            sg_v[0][i],
-                                            ng_v[0][i],
-                                            omega_v[0][i],
-                                            cv_v[0][i]);
+      if (derivs) {
+        Dual<9> r = model_->WaterContent(Dual<9>::Variable(phi_v[0][i], 0),
+                                         Dual<9>::Variable(sl_v[0][i], 1),
+                                         Dual<9>::Variable(nl_v[0][i], 2),
+                                         Dual<9>::Variable(si_v[0][i], 3),
+                                         Dual<9>::Variable(ni_v[0][i], 4),
+                                         Dual<9>::Variable(sg_v[0][i], 5),
+                                         Dual<9>::Variable(ng_v[0][i], 6),
+                                         Dual<9>::Variable(omega_v[0][i], 7),
+                                         Dual<9>::Variable(cv_v[0][i], 8));
+        result_v[0][i] = r.value();
+        if (dresult_phi) dresult_phi[i] = r.d(0);
+        if (dresult_sl) dresult_sl[i] = r.d(1);
+        if (dresult_nl) dresult_nl[i] = r.d(2);
+        if (dresult_si) dresult_si[i] = r.d(3);
+        if (dresult_ni) dresult_ni[i] = r.d(4);
+        if (dresult_sg) dresult_sg[i] = r.d(5);
+        if (dresult_ng) dresult_ng[i] = r.d(6);
+        if (dresult_omega) dresult_omega[i] = r.d(7);
+        if (dresult_cv) dresult_cv[i] = r.d(8);
+      } else {
+        result_v[0][i] = model_->WaterContent(phi_v[0][i],
+                                              sl_v[0][i],
+                                              nl_v[0][i],
+                                              si_v[0][i],
+                                              ni_v[0][i],
+                                              sg_v[0][i],
+                                              ng_v[0][i],
+                                              omega_v[0][i],
+                                              cv_v[0][i]);
+      }
     }
   }
+  dresult_cache_.Validate();
 }
 
 
@@ -136,6 +175,7 @@ ThreePhaseWaterContentEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> sl = S.GetPtr<CompositeVector>(sl_key_, tag);
@@ -147,261 +187,54 @@ ThreePhaseWaterContentEvaluator::EvaluatePartialDerivative_(
   Teuchos::RCP<const CompositeVector> omega = S.GetPtr<CompositeVector>(omega_key_, tag);
   Teuchos::RCP<const CompositeVector> cv = S.GetPtr<CompositeVector>(cv_key_, tag);
 
-  if (wrt_key == phi_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDPorosity(phi_v[0][i],
-                                                        sl_v[0][i],
-                                                        nl_v[0][i],
-                                                        si_v[0][i],
-                                                        ni_v[0][i],
-                                                        sg_v[0][i],
-                                                        ng_v[0][i],
-                                                        omega_v[0][i],
-                                                        cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == sl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDSaturationLiquid(phi_v[0][i],
-                                                                sl_v[0][i],
-                                                                nl_v[0][i],
-                                                                si_v[0][i],
-                                                                ni_v[0][i],
-                                                                sg_v[0][i],
-                                                                ng_v[0][i],
-                                                                omega_v[0][i],
-                                                                cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == nl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolarDensityLiquid(phi_v[0][i],
-                                                                  sl_v[0][i],
-                                                                  nl_v[0][i],
-                                                                  si_v[0][i],
-                                                                  ni_v[0][i],
-                                                                  sg_v[0][i],
-                                                                  ng_v[0][i],
-                                                                  omega_v[0][i],
-                                                                  cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == si_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDSaturationIce(phi_v[0][i],
-                                                             sl_v[0][i],
-                                                             nl_v[0][i],
-                                                             si_v[0][i],
-                                                             ni_v[0][i],
-                                                             sg_v[0][i],
-                                                             ng_v[0][i],
-                                                             omega_v[0][i],
-                                                             cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ni_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolarDensityIce(phi_v[0][i],
-                                                               sl_v[0][i],
-                                                               nl_v[0][i],
-                                                               si_v[0][i],
-                                                               ni_v[0][i],
-                                                               sg_v[0][i],
-                                                               ng_v[0][i],
-                                                               omega_v[0][i],
-                                                               cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == sg_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDSaturationGas(phi_v[0][i],
-                                                             sl_v[0][i],
-                                                             nl_v[0][i],
-                                                             si_v[0][i],
-                                                             ni_v[0][i],
-                                                             sg_v[0][i],
-                                                             ng_v[0][i],
-                                                             omega_v[0][i],
-                                                             cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == ng_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolarDensityGas(phi_v[0][i],
-                                                               sl_v[0][i],
-                                                               nl_v[0][i],
-                                                               si_v[0][i],
-                                                               ni_v[0][i],
-                                                               sg_v[0][i],
-                                                               ng_v[0][i],
-                                                               omega_v[0][i],
-                                                               cv_v[0][i]);
-      }
-    }
-
-  } else if (wrt_key == omega_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolFracGas(phi_v[0][i],
-                                                          sl_v[0][i],
-                                                          nl_v[0][i],
-                                                          si_v[0][i],
-                                                          ni_v[0][i],
-                                                          sg_v[0][i],
-                                                          ng_v[0][i],
-                                                          omega_v[0][i],
-                                                          cv_v[0][i]);
-      }
-    }
+  // partial derivatives computed with the value are copied
+  int wrt = -1;
+  if (wrt_key == phi_key_) wrt = 0;
+  if (wrt_key == sl_key_) wrt = 1;
+  if (wrt_key == nl_key_) wrt = 2;
+  if (wrt_key == si_key_) wrt = 3;
+  if (wrt_key == ni_key_) wrt = 4;
+  if (wrt_key == sg_key_) wrt = 5;
+  if (wrt_key == ng_key_) wrt = 6;
+  if (wrt_key == omega_key_) wrt = 7;
+  if (wrt_key == cv_key_) wrt = 8;
+  if (wrt >= 0 && dresult_cache_.Has(wrt)) {
+    *result[0] = dresult_cache_.Get(wrt);
+    return;
+  }
 
-  } else if (wrt_key == cv_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+  // otherwise computed as with the value, on dual numbers, so that values do
+  // not depend on the order of requests
+  AMANZI_ASSERT(wrt >= 0);
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
+    const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
+    const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
+    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
+    const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
+    const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
+    const Epetra_MultiVector& omega_v = *omega->ViewComponent(*comp, false);
+    const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDCellVolume(phi_v[0][i],
-                                                          sl_v[0][i],
-                                                          nl_v[0][i],
-                                                          si_v[0][i],
-                                                          ni_v[0][i],
-                                                          sg_v[0][i],
-                                                          ng_v[0][i],
-                                                          omega_v[0][i],
-                                                          cv_v[0][i]);
-      }
+    int ncomp = result[0]->size(*comp, false);
+    for (int i = 0; i != ncomp; ++i) {
+      Dual<9> r = model_->WaterContent(Dual<9>::Variable(phi_v[0][i], 0),
+                                       Dual<9>::Variable(sl_v[0][i], 1),
+                                       Dual<9>::Variable(nl_v[0][i], 2),
+                                       Dual<9>::Variable(si_v[0][i], 3),
+                                       Dual<9>::Variable(ni_v[0][i], 4),
+                                       Dual<9>::Variable(sg_v[0][i], 5),
+                                       Dual<9>::Variable(ng_v[0][i], 6),
+                                       Dual<9>::Variable(omega_v[0][i], 7),
+                                       Dual<9>::Variable(cv_v[0][i], 8));
+      result_v[0][i] = r.d(wrt);
     }
-
-  } else {
-    AMANZI_ASSERT(0);
   }
+
+  // from now on, computed with the value
+  if (wrt >= 0) dresult_cache_.Set(wrt, *result[0]);
 }
 
 
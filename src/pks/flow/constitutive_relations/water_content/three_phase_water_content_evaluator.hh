@@ -37,6 +37,7 @@ Specified with evaluator type: `"three phase water content`"
 
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
+#include "PartialDerivativeCache.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -77,6 +78,9 @@ class ThreePhaseWaterContentEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<ThreePhaseWaterContentModel> model_;
 
+  // partial derivatives computed with the value
+  PartialDerivativeCache dresult_cache_;
+
  private:
   static Utils::RegisteredFactory<Evaluator, ThreePhaseWaterContentEvaluator> reg_;
 };
@@ -18,6 +18,8 @@ Water content for a three-phase, gas+liquid+ice evaluator.
 #ifndef AMANZI_FLOW_THREE_PHASE_WATER_CONTENT_MODEL_HH_
 #define AMANZI_FLOW_THREE_PHASE_WATER_CONTENT_MODEL_HH_
 
+#include <cmath>
+
 namespace Amanzi {
 namespace Flow {
 namespace Relations {
@@ -36,6 +38,22 @@ class ThreePhaseWaterContentModel {
                       double omega,
                       double cv) const;
 
+  // The same, templated on the scalar type, so that evaluating on Dual
+  // numbers gives the value and all partial derivatives at once.
+  template <typename Scalar>
+  Scalar WaterContent(const Scalar& phi,
+                      const Scalar& sl,
+                      const Scalar& nl,
+                      const Scalar& si,
+                      const Scalar& ni,
+                      const Scalar& sg,
+                      const Scalar& ng,
+                      const Scalar& omega,
+                      const Scalar& cv) const
+  {
+    return cv * phi * (ng * omega * sg + ni * si + nl * sl);
+  }
+
   double DWaterContentDPorosity(double phi,
                                 double sl,
                                 double nl,
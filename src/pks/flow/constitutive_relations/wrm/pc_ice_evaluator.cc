@@ -14,6 +14,7 @@
 
 #include "pc_ice_water.hh"
 #include "pc_ice_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -48,6 +49,7 @@ PCIceEvaluator::Clone() const
 void
 PCIceEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   // Pull dependencies out of state.
   Teuchos::RCP<const CompositeVector> temp = S.GetPtr<CompositeVector>(temp_key_, tag);
@@ -76,6 +78,7 @@ PCIceEvaluator::EvaluatePartialDerivative_(const State& S,
                                            const Tag& wrt_tag,
                                            const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
 
   // Pull dependencies out of state.
@@ -14,6 +14,7 @@
 
 #include "pc_liq_atm.hh"
 #include "pc_liquid_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -44,6 +45,7 @@ PCLiquidEvaluator::Clone() const
 void
 PCLiquidEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   // Pull dependencies out of state.
   Teuchos::RCP<const CompositeVector> pres = S.GetPtr<CompositeVector>(pres_key_, tag);
@@ -68,6 +70,7 @@ PCLiquidEvaluator::EvaluatePartialDerivative_(const State& S,
                                               const Tag& wrt_tag,
                                               const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(wrt_key == pres_key_);
 
   // Pull dependencies out of state.
@@ -9,6 +9,8 @@
 
 //! RelPermEvaluator: evaluates relative permeability using water retention models.
 #include "rel_perm_evaluator.hh"
+#include "BoundaryFaceMap.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -105,6 +107,7 @@ RelPermEvaluator::EnsureCompatibility_ToDeps_(State& S)
 {
   Key my_key = my_keys_.front().first;
   Tag tag = my_keys_.front().second;
+  Relations::requireBoundaryFaceMap(S, Keys::getDomain(my_key));
   const auto& my_fac = S.Require<CompositeVector, CompositeVectorSpace>(my_key, tag);
 
   // If my requirements have not yet been set, we'll have to hope they
@@ -129,16 +132,31 @@ RelPermEvaluator::EnsureCompatibility_ToDeps_(State& S)
 
 
 void
-RelPermEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
+RelPermEvaluator::InitializePartition_(const State& S,
+                                       const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
 {
-  result[0]->PutScalar(0.);
-
   // Initialize the MeshPartition
   if (!wrms_->first->initialized()) {
-    wrms_->first->Initialize(result[0]->Mesh(), -1);
+    wrms_->first->Initialize(mesh, -1);
     wrms_->first->Verify();
   }
 
+  // sort cells and boundary faces by region
+  if (!indices_.initialized()) {
+    const auto& bf_map = Relations::getBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first));
+    indices_.Initialize(mesh, bf_map, *wrms_->first, wrms_->second.size());
+  }
+}
+
+
+void
+RelPermEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
+{
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
+  result[0]->PutScalar(0.);
+
+  InitializePartition_(S, result[0]->Mesh());
+
   // Evaluate k_rel.
   // -- Evaluate the model to calculate krel on cells.
   Tag tag = my_keys_.front().second;
@@ -146,11 +164,12 @@ RelPermEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>&
     *S.GetPtr<CompositeVector>(sat_key_, tag)->ViewComponent("cell", false);
   Epetra_MultiVector& res_c = *result[0]->ViewComponent("cell", false);
 
-  int ncells = res_c.MyLength();
-  for (unsigned int c = 0; c != ncells; ++c) {
-    int index = (*wrms_->first)[c];
-    res_c[0][c] = std::max(wrms_->second[index]->k_relative(sat_c[0][c]), min_val_);
+  for (int r = 0; r != wrms_->second.size(); ++r) {
+    const auto& cells = indices_.cells[r];
+    wrms_->second[r]->k_relative_batch(cells.size(), cells.data(), sat_c[0], res_c[0]);
   }
+  int ncells = res_c.MyLength();
+  for (int c = 0; c != ncells; ++c) res_c[0][c] = std::max(res_c[0][c], min_val_);
 
   // -- Potentially evaluate the model on boundary faces as well.
   if (result[0]->HasComponent("boundary_face")) {
@@ -158,37 +177,34 @@ RelPermEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>&
       *S.GetPtr<CompositeVector>(sat_key_, tag)->ViewComponent("boundary_face", false);
     Epetra_MultiVector& res_bf = *result[0]->ViewComponent("boundary_face", false);
 
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = result[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->getMap(AmanziMesh::Entity_kind::BOUNDARY_FACE, false);
-    const Epetra_Map& face_map = mesh->getMap(AmanziMesh::Entity_kind::FACE, false);
-
-    // Evaluate the model to calculate krel.
+    // Evaluate the model to calculate krel, using the WRM of the internal cell.
     int nbfaces = res_bf.MyLength();
-    for (unsigned int bf = 0; bf != nbfaces; ++bf) {
-      // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      auto cells = mesh->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      int index = (*wrms_->first)[cells[0]];
-      double krel;
-      if (boundary_krel_ == BoundaryRelPerm::HARMONIC_MEAN) {
-        double krelb = std::max(wrms_->second[index]->k_relative(sat_bf[0][bf]), min_val_);
-        double kreli = std::max(wrms_->second[index]->k_relative(sat_c[0][cells[0]]), min_val_);
-        krel = 1.0 / (1.0 / krelb + 1.0 / kreli);
-      } else if (boundary_krel_ == BoundaryRelPerm::ARITHMETIC_MEAN) {
-        double krelb = std::max(wrms_->second[index]->k_relative(sat_bf[0][bf]), min_val_);
-        double kreli = std::max(wrms_->second[index]->k_relative(sat_c[0][cells[0]]), min_val_);
-        krel = (krelb + kreli) / 2.0;
-      } else if (boundary_krel_ == BoundaryRelPerm::INTERIOR_PRESSURE) {
-        krel = wrms_->second[index]->k_relative(sat_c[0][cells[0]]);
-      } else if (boundary_krel_ == BoundaryRelPerm::ONE) {
-        krel = 1.;
-      } else {
-        krel = wrms_->second[index]->k_relative(sat_bf[0][bf]);
+    if (boundary_krel_ == BoundaryRelPerm::ONE) {
+      res_bf.PutScalar(1.);
+    } else if (boundary_krel_ == BoundaryRelPerm::INTERIOR_PRESSURE) {
+      for (int r = 0; r != wrms_->second.size(); ++r) {
+        for (int bf : indices_.bfaces[r]) {
+          res_bf[0][bf] = wrms_->second[r]->k_relative(sat_c[0][indices_.bface_map->cell[bf]]);
+        }
+      }
+    } else {
+      for (int r = 0; r != wrms_->second.size(); ++r) {
+        const auto& bfaces = indices_.bfaces[r];
+        wrms_->second[r]->k_relative_batch(bfaces.size(), bfaces.data(), sat_bf[0], res_bf[0]);
+      }
+
+      if (boundary_krel_ == BoundaryRelPerm::HARMONIC_MEAN ||
+          boundary_krel_ == BoundaryRelPerm::ARITHMETIC_MEAN) {
+        for (int bf = 0; bf != nbfaces; ++bf) {
+          double krelb = std::max(res_bf[0][bf], min_val_);
+          double kreli = std::max(res_c[0][indices_.bface_map->cell[bf]], min_val_);
+          res_bf[0][bf] = boundary_krel_ == BoundaryRelPerm::HARMONIC_MEAN ?
+                            1.0 / (1.0 / krelb + 1.0 / kreli) :
+                            (krelb + kreli) / 2.0;
+        }
       }
-      res_bf[0][bf] = std::max(krel, min_val_);
     }
+    for (int bf = 0; bf != nbfaces; ++bf) res_bf[0][bf] = std::max(res_bf[0][bf], min_val_);
   }
 
   // Patch k_rel with surface rel perm values
@@ -251,11 +267,8 @@ RelPermEvaluator::EvaluatePartialDerivative_(const State& S,
                                              const Tag& wrt_tag,
                                              const std::vector<CompositeVector*>& result)
 {
-  // Initialize the MeshPartition
-  if (!wrms_->first->initialized()) {
-    wrms_->first->Initialize(result[0]->Mesh(), -1);
-    wrms_->first->Verify();
-  }
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
+  InitializePartition_(S, result[0]->Mesh());
 
   Tag tag = my_keys_.front().second;
 
@@ -268,12 +281,12 @@ RelPermEvaluator::EvaluatePartialDerivative_(const State& S,
       *S.GetPtr<CompositeVector>(sat_key_, tag)->ViewComponent("cell", false);
     Epetra_MultiVector& res_c = *result[0]->ViewComponent("cell", false);
 
-    int ncells = res_c.MyLength();
-    for (unsigned int c = 0; c != ncells; ++c) {
-      int index = (*wrms_->first)[c];
-      res_c[0][c] = wrms_->second[index]->d_k_relative(sat_c[0][c]);
-      AMANZI_ASSERT(res_c[0][c] >= 0.);
+    for (int r = 0; r != wrms_->second.size(); ++r) {
+      const auto& cells = indices_.cells[r];
+      wrms_->second[r]->d_k_relative_batch(cells.size(), cells.data(), sat_c[0], res_c[0]);
     }
+    int ncells = res_c.MyLength();
+    for (int c = 0; c != ncells; ++c) AMANZI_ASSERT(res_c[0][c] >= 0.);
 
     // -- Potentially evaluate the model on boundary faces as well.
     if (result[0]->HasComponent("boundary_face")) {
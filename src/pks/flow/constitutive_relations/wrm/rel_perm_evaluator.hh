@@ -206,8 +206,10 @@ class RelPermEvaluator : public EvaluatorSecondaryMonotypeCV {
 
  protected:
   void InitializeFromPlist_();
+  void InitializePartition_(const State& S, const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
 
   Teuchos::RCP<WRMPartition> wrms_;
+  WRMPartitionIndices indices_;
   Key sat_key_;
   Key dens_key_;
   Key visc_key_;
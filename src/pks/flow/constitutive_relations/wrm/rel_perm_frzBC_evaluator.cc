@@ -11,6 +11,8 @@
 //! Evaluates relative permeability using an empirical model for frozen conditions.
 #include "rel_perm_brooks_corey_freezing_coeff.hh"
 #include "rel_perm_frzBC_evaluator.hh"
+#include "BoundaryFaceMap.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -113,6 +115,7 @@ RelPermFrzBCEvaluator::EnsureCompatibility_ToDeps_(State& S)
 {
   Key my_key = my_keys_.front().first;
   Tag tag = my_keys_.front().second;
+  Relations::requireBoundaryFaceMap(S, Keys::getDomain(my_key));
   const auto& my_fac = S.Require<CompositeVector, CompositeVectorSpace>(my_key, tag);
 
   // If my requirements have not yet been set, we'll have to hope they
@@ -139,6 +142,7 @@ RelPermFrzBCEvaluator::EnsureCompatibility_ToDeps_(State& S)
 void
 RelPermFrzBCEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   result[0]->PutScalar(0.);
 
   // Initialize the MeshPartition
@@ -172,41 +176,36 @@ RelPermFrzBCEvaluator::Evaluate_(const State& S, const std::vector<CompositeVect
       *S.GetPtr<CompositeVector>(sat_gas_key_, tag)->ViewComponent("boundary_face", false);
     Epetra_MultiVector& res_bf = *result[0]->ViewComponent("boundary_face", false);
 
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = result[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->getMap(AmanziMesh::Entity_kind::BOUNDARY_FACE, false);
-    const Epetra_Map& face_map = mesh->getMap(AmanziMesh::Entity_kind::FACE, false);
+    const auto& bf_cell =
+      Relations::getBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first)).cell;
 
     // Evaluate the model to calculate krel.
     int nbfaces = res_bf.MyLength();
     for (unsigned int bf = 0; bf != nbfaces; ++bf) {
       // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      auto cells = mesh->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
+      AmanziMesh::Entity_ID c = bf_cell[bf];
 
-      int index = (*wrms_->first)[cells[0]];
+      int index = (*wrms_->first)[c];
       double sat_res = wrms_->second[index]->residualSaturation();
       double krel;
 
       double coef_b = BrooksCoreyFrzCoef::frzcoef(sat_bf[0][bf], sat_gas_bf[0][bf], omega_);
-      double coef_c =
-        BrooksCoreyFrzCoef::frzcoef(sat_c[0][cells[0]], sat_gas_c[0][cells[0]], omega_);
+      double coef_c = BrooksCoreyFrzCoef::frzcoef(sat_c[0][c], sat_gas_c[0][c], omega_);
 
       if (boundary_krel_ == BoundaryRelPerm::HARMONIC_MEAN) {
         double krelb =
           std::max(wrms_->second[index]->k_relative(1. - sat_gas_bf[0][bf]) * coef_b, min_val_);
         double kreli = std::max(
-          wrms_->second[index]->k_relative(1. - sat_gas_c[0][cells[0]]) * coef_c, min_val_);
+          wrms_->second[index]->k_relative(1. - sat_gas_c[0][c]) * coef_c, min_val_);
         krel = 1.0 / (1.0 / krelb + 1.0 / kreli);
       } else if (boundary_krel_ == BoundaryRelPerm::ARITHMETIC_MEAN) {
         double krelb =
           std::max(wrms_->second[index]->k_relative(1. - sat_gas_bf[0][bf]) * coef_b, min_val_);
         double kreli = std::max(
-          wrms_->second[index]->k_relative(1. - sat_gas_c[0][cells[0]]) * coef_c, min_val_);
+          wrms_->second[index]->k_relative(1. - sat_gas_c[0][c]) * coef_c, min_val_);
         krel = (krelb + kreli) / 2.0;
       } else if (boundary_krel_ == BoundaryRelPerm::INTERIOR_PRESSURE) {
-        krel = std::max(wrms_->second[index]->k_relative(1. - sat_gas_c[0][cells[0]]) * coef_c,
-                        min_val_);
+        krel = std::max(wrms_->second[index]->k_relative(1. - sat_gas_c[0][c]) * coef_c, min_val_);
       } else if (boundary_krel_ == BoundaryRelPerm::ONE) {
         krel = 1.;
       } else {
@@ -276,6 +275,7 @@ RelPermFrzBCEvaluator::EvaluatePartialDerivative_(const State& S,
                                                   const Tag& wrt_tag,
                                                   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // Initialize the MeshPartition
   if (!wrms_->first->initialized()) {
     wrms_->first->Initialize(result[0]->Mesh(), -1);
@@ -13,6 +13,7 @@
 */
 
 #include "suction_head_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -60,6 +61,7 @@ SuctionHeadEvaluator::InitializeFromPlist_()
 void
 SuctionHeadEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   // Initialize the MeshPartition
   if (!wrms_->first->initialized()) {
     wrms_->first->Initialize(result[0]->Mesh(), -1);
@@ -87,6 +89,7 @@ SuctionHeadEvaluator::EvaluatePartialDerivative_(const State& S,
                                                  const Tag& wrt_tag,
                                                  const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // Initialize the MeshPartition
   if (!wrms_->first->initialized()) {
     wrms_->first->Initialize(result[0]->Mesh(), -1);
@@ -55,6 +55,58 @@ class WRM {
   virtual double residualSaturation() = 0;
   virtual double suction_head(double saturation) { return 0.; };
   virtual double d_suction_head(double saturation) { return 0.; };
+
+  // Batched evaluation on the entries idx[0], ..., idx[n-1] of the input and
+  // output arrays.  The defaults call the pointwise methods; models deriving
+  // from WRMBatched get loops with no virtual call per entry.
+  virtual void k_relative_batch(int n, const int* idx, const double* sat, double* kr)
+  {
+    for (int k = 0; k != n; ++k) kr[idx[k]] = k_relative(sat[idx[k]]);
+  }
+  virtual void d_k_relative_batch(int n, const int* idx, const double* sat, double* dkr)
+  {
+    for (int k = 0; k != n; ++k) dkr[idx[k]] = d_k_relative(sat[idx[k]]);
+  }
+  virtual void saturation_batch(int n, const int* idx, const double* pc, double* sat)
+  {
+    for (int k = 0; k != n; ++k) sat[idx[k]] = saturation(pc[idx[k]]);
+  }
+  virtual void d_saturation_batch(int n, const int* idx, const double* pc, double* dsat)
+  {
+    for (int k = 0; k != n; ++k) dsat[idx[k]] = d_saturation(pc[idx[k]]);
+  }
+};
+
+
+//
+// Implements the batched methods of WRM by calling the pointwise methods of
+// Derived directly, so the compiler can inline (and possibly vectorize) them:
+//
+//   class WRMFoo : public WRMBatched<WRMFoo> { ... };
+//
+template <class Derived>
+class WRMBatched : public WRM {
+ public:
+  void k_relative_batch(int n, const int* idx, const double* sat, double* kr) override
+  {
+    Derived& self = static_cast<Derived&>(*this);
+    for (int k = 0; k != n; ++k) kr[idx[k]] = self.Derived::k_relative(sat[idx[k]]);
+  }
+  void d_k_relative_batch(int n, const int* idx, const double* sat, double* dkr) override
+  {
+    Derived& self = static_cast<Derived&>(*this);
+    for (int k = 0; k != n; ++k) dkr[idx[k]] = self.Derived::d_k_relative(sat[idx[k]]);
+  }
+  void saturation_batch(int n, const int* idx, const double* pc, double* sat) override
+  {
+    Derived& self = static_cast<Derived&>(*this);
+    for (int k = 0; k != n; ++k) sat[idx[k]] = self.Derived::saturation(pc[idx[k]]);
+  }
+  void d_saturation_batch(int n, const int* idx, const double* pc, double* dsat) override
+  {
+    Derived& self = static_cast<Derived&>(*this);
+    for (int k = 0; k != n; ++k) dsat[idx[k]] = self.Derived::d_saturation(pc[idx[k]]);
+  }
 };
 
 typedef double (WRM::*KRelFn)(double pc);
@@ -52,7 +52,7 @@ Example:
 namespace Amanzi {
 namespace Flow {
 
-class WRMBrooksCorey : public WRM {
+class WRMBrooksCorey : public WRMBatched<WRMBrooksCorey> {
  public:
   explicit WRMBrooksCorey(Teuchos::ParameterList& plist);
 
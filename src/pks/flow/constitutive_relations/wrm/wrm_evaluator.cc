@@ -15,6 +15,8 @@
 
 #include "wrm_evaluator.hh"
 #include "wrm_factory.hh"
+#include "BoundaryFaceMap.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -81,23 +83,47 @@ WRMEvaluator::InitializeFromPlist_()
 
 
 void
-WRMEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
+WRMEvaluator::InitializePartition_(const State& S,
+                                   const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
 {
   // Initialize the MeshPartition
   if (!wrms_->first->initialized()) {
-    wrms_->first->Initialize(results[0]->Mesh(), -1);
+    wrms_->first->Initialize(mesh, -1);
     wrms_->first->Verify();
   }
 
+  // sort cells and boundary faces by region
+  if (!indices_.initialized()) {
+    const auto& bf_map = Relations::getBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first));
+    indices_.Initialize(mesh, bf_map, *wrms_->first, wrms_->second.size());
+  }
+}
+
+
+// Structure is the same for all keys; boundary faces need the map of the mesh.
+void
+WRMEvaluator::EnsureCompatibility_Structure_(State& S)
+{
+  EnsureCompatibility_StructureSame_(S);
+  Relations::requireBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first));
+}
+
+
+void
+WRMEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
+{
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
+  InitializePartition_(S, results[0]->Mesh());
+
   Tag tag = my_keys_.front().second;
   Epetra_MultiVector& sat_c = *results[0]->ViewComponent("cell", false);
   const Epetra_MultiVector& pres_c =
     *S.GetPtr<CompositeVector>(cap_pres_key_, tag)->ViewComponent("cell", false);
 
-  // calculate cell values
-  AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c = 0; c != ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->saturation(pres_c[0][c]);
+  // calculate cell values, one region at a time
+  for (int r = 0; r != wrms_->second.size(); ++r) {
+    const auto& cells = indices_.cells[r];
+    wrms_->second[r]->saturation_batch(cells.size(), cells.data(), pres_c[0], sat_c[0]);
   }
 
   // Potentially do face values as well.
@@ -106,21 +132,10 @@ WRMEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& res
     const Epetra_MultiVector& pres_bf =
       *S.GetPtr<CompositeVector>(cap_pres_key_, tag)->ViewComponent("boundary_face", false);
 
-    // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = results[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->getMap(AmanziMesh::Entity_kind::BOUNDARY_FACE, false);
-    const Epetra_Map& face_map = mesh->getMap(AmanziMesh::Entity_kind::FACE, false);
-
-    // calculate boundary face values
-    int nbfaces = sat_bf.MyLength();
-    for (int bf = 0; bf != nbfaces; ++bf) {
-      // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      auto cells = mesh->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      int index = (*wrms_->first)[cells[0]];
-      sat_bf[0][bf] = wrms_->second[index]->saturation(pres_bf[0][bf]);
+    // calculate boundary face values, grouped by the region of their inner cell
+    for (int r = 0; r != wrms_->second.size(); ++r) {
+      const auto& bfaces = indices_.bfaces[r];
+      wrms_->second[r]->saturation_batch(bfaces.size(), bfaces.data(), pres_bf[0], sat_bf[0]);
     }
   }
 
@@ -152,21 +167,18 @@ WRMEvaluator::EvaluatePartialDerivative_(const State& S,
                                          const Tag& wrt_tag,
                                          const std::vector<CompositeVector*>& results)
 {
-  // Initialize the MeshPartition
-  if (!wrms_->first->initialized()) {
-    wrms_->first->Initialize(results[0]->Mesh(), -1);
-    wrms_->first->Verify();
-  }
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
+  InitializePartition_(S, results[0]->Mesh());
 
   Tag tag = my_keys_.front().second;
   Epetra_MultiVector& sat_c = *results[0]->ViewComponent("cell", false);
   const Epetra_MultiVector& pres_c =
     *S.GetPtr<CompositeVector>(cap_pres_key_, tag)->ViewComponent("cell", false);
 
-  // calculate cell values
-  AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c = 0; c != ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->d_saturation(pres_c[0][c]);
+  // calculate cell values, one region at a time
+  for (int r = 0; r != wrms_->second.size(); ++r) {
+    const auto& cells = indices_.cells[r];
+    wrms_->second[r]->d_saturation_batch(cells.size(), cells.data(), pres_c[0], sat_c[0]);
   }
 
   // Potentially do face values as well.
@@ -175,21 +187,10 @@ WRMEvaluator::EvaluatePartialDerivative_(const State& S,
     const Epetra_MultiVector& pres_bf =
       *S.GetPtr<CompositeVector>(cap_pres_key_, tag)->ViewComponent("boundary_face", false);
 
-    // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = results[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->getMap(AmanziMesh::Entity_kind::BOUNDARY_FACE, false);
-    const Epetra_Map& face_map = mesh->getMap(AmanziMesh::Entity_kind::FACE, false);
-
-    // calculate boundary face values
-    int nbfaces = sat_bf.MyLength();
-    for (int bf = 0; bf != nbfaces; ++bf) {
-      // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      auto cells = mesh->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      int index = (*wrms_->first)[cells[0]];
-      sat_bf[0][bf] = wrms_->second[index]->d_saturation(pres_bf[0][bf]);
+    // calculate boundary face values, grouped by the region of their inner cell
+    for (int r = 0; r != wrms_->second.size(); ++r) {
+      const auto& bfaces = indices_.bfaces[r];
+      wrms_->second[r]->d_saturation_batch(bfaces.size(), bfaces.data(), pres_bf[0], sat_bf[0]);
     }
   }
 
@@ -95,6 +95,7 @@ class WRMEvaluator : public EvaluatorSecondaryMonotypeCV {
 
  protected:
   void InitializeFromPlist_();
+  void InitializePartition_(const State& S, const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
 
   // Required methods from EvaluatorSecondaryMonotypeCV
   virtual void Evaluate_(const State& S, const std::vector<CompositeVector*>& results) override;
@@ -103,13 +104,11 @@ class WRMEvaluator : public EvaluatorSecondaryMonotypeCV {
                                           const Tag& wrt_tag,
                                           const std::vector<CompositeVector*>& results) override;
 
-  virtual void EnsureCompatibility_Structure_(State& S) override
-  {
-    EnsureCompatibility_StructureSame_(S);
-  }
+  virtual void EnsureCompatibility_Structure_(State& S) override;
 
  protected:
   Teuchos::RCP<WRMPartition> wrms_;
+  WRMPartitionIndices indices_;
   bool calc_other_sat_;
   Key cap_pres_key_;
 
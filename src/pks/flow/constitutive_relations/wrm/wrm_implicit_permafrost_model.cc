@@ -8,6 +8,7 @@
 */
 
 //! Painter's original, implicitly defined permafrost model.
+#include <algorithm>
 #include <cmath>
 
 #include "Epetra_SerialDenseMatrix.h"
@@ -25,14 +26,231 @@
 namespace Amanzi {
 namespace Flow {
 
+// Hermite basis functions on [0,1] and their derivatives
+namespace {
+
+inline void
+hermiteBasis(double t, double (&h)[4], double (&dh)[4])
+{
+  double t2 = t * t, t3 = t2 * t;
+  h[0] = 2 * t3 - 3 * t2 + 1; // value at 0
+  h[1] = -2 * t3 + 3 * t2;    // value at 1
+  h[2] = t3 - 2 * t2 + t;     // slope at 0
+  h[3] = t3 - t2;             // slope at 1
+  dh[0] = 6 * t2 - 6 * t;
+  dh[1] = -6 * t2 + 6 * t;
+  dh[2] = 3 * t2 - 4 * t + 1;
+  dh[3] = 3 * t2 - 2 * t;
+}
+
+} // namespace
+
+
+double
+WRMImplicitPermafrostTable::Setup(const NodeFunction& f,
+                                  double pc_min,
+                                  double pc_max,
+                                  double tol,
+                                  int npoints,
+                                  int npoints_max)
+{
+  pc_min_ = pc_min;
+  pc_max_ = pc_max;
+  x0_ = std::log10(pc_min);
+
+  double error = 0.;
+  while (true) {
+    bool last = 2 * npoints > npoints_max;
+    error = Build_(f, npoints, tol, last);
+    if (error <= tol || last) break;
+    npoints *= 2;
+  }
+  return error;
+}
+
+
+double
+WRMImplicitPermafrostTable::Build_(const NodeFunction& f, int npoints, double tol, bool invalidate)
+{
+  npoints_ = npoints;
+  int ndecades = (int)std::ceil(std::log10(pc_max_) - x0_ - 1.e-12);
+  n_ = ndecades * npoints + 1;
+  pc_max_ = std::pow(10., x0_ + ndecades);
+  double h = 1. / npoints;
+  double ln10 = std::log(10.);
+
+  // node values and first derivatives, in log10 coordinates
+  nodes_.assign(4 * n_ * n_, 0.);
+  std::vector<char> ok(n_ * n_, 0);
+  for (int i = 0; i != n_; ++i) {
+    double pc_liq = std::pow(10., x0_ + i * h);
+    for (int j = 0; j != n_; ++j) {
+      double pc_ice = std::pow(10., x0_ + j * h);
+      double si, dsi_dpc_liq, dsi_dpc_ice;
+      if (f(pc_liq, pc_ice, si, dsi_dpc_liq, dsi_dpc_ice) && std::isfinite(dsi_dpc_liq) &&
+          std::isfinite(dsi_dpc_ice)) {
+        double* node = &nodes_[4 * (i * n_ + j)];
+        node[0] = si;
+        node[1] = dsi_dpc_liq * pc_liq * ln10;
+        node[2] = dsi_dpc_ice * pc_ice * ln10;
+        ok[i * n_ + j] = 1;
+      }
+    }
+  }
+
+  // cross derivatives, by differencing f_y in x
+  for (int i = 0; i != n_; ++i) {
+    for (int j = 0; j != n_; ++j) {
+      if (!ok[i * n_ + j]) continue;
+      int im = (i > 0 && ok[(i - 1) * n_ + j]) ? i - 1 : i;
+      int ip = (i < n_ - 1 && ok[(i + 1) * n_ + j]) ? i + 1 : i;
+      if (ip > im) {
+        nodes_[4 * (i * n_ + j) + 3] =
+          (nodes_[4 * (ip * n_ + j) + 2] - nodes_[4 * (im * n_ + j) + 2]) / ((ip - im) * h);
+      }
+    }
+  }
+
+  // a cell is valid if its corners and its center were solved, and then
+  // checked for error at the center
+  valid_.assign((n_ - 1) * (n_ - 1), 0);
+  double max_error = 0.;
+  for (int i = 0; i != n_ - 1; ++i) {
+    for (int j = 0; j != n_ - 1; ++j) {
+      if (!(ok[i * n_ + j] && ok[(i + 1) * n_ + j] && ok[i * n_ + j + 1] &&
+            ok[(i + 1) * n_ + j + 1]))
+        continue;
+
+      double pc_liq = std::pow(10., x0_ + (i + 0.5) * h);
+      double pc_ice = std::pow(10., x0_ + (j + 0.5) * h);
+      double si, dsi_dpc_liq, dsi_dpc_ice;
+      if (!f(pc_liq, pc_ice, si, dsi_dpc_liq, dsi_dpc_ice)) continue;
+
+      valid_[i * (n_ - 1) + j] = 1;
+      double si_table, d1, d2;
+      Evaluate(pc_liq, pc_ice, si_table, d1, d2);
+      double error = std::abs(si_table - si);
+      if (invalidate && error > tol) {
+        valid_[i * (n_ - 1) + j] = 0;
+      } else {
+        max_error = std::max(max_error, error);
+      }
+    }
+  }
+  return max_error;
+}
+
+
+bool
+WRMImplicitPermafrostTable::Evaluate(double pc_liq,
+                                     double pc_ice,
+                                     double& si,
+                                     double& dsi_dpc_liq,
+                                     double& dsi_dpc_ice) const
+{
+  if (!(pc_liq >= pc_min_ && pc_liq < pc_max_ && pc_ice >= pc_min_ && pc_ice < pc_max_))
+    return false;
+
+  double x = (std::log10(pc_liq) - x0_) * npoints_;
+  double y = (std::log10(pc_ice) - x0_) * npoints_;
+  int i = std::min((int)x, n_ - 2);
+  int j = std::min((int)y, n_ - 2);
+  if (!valid_[i * (n_ - 1) + j]) return false;
+
+  double h = 1. / npoints_;
+  double hx[4], dhx[4], hy[4], dhy[4];
+  hermiteBasis(x - i, hx, dhx);
+  hermiteBasis(y - j, hy, dhy);
+
+  double f = 0., f_x = 0., f_y = 0.;
+  for (int a = 0; a != 2; ++a) {
+    for (int b = 0; b != 2; ++b) {
+      const double* node = &nodes_[4 * ((i + a) * n_ + j + b)];
+      // value, x-slope, y-slope, and cross coefficients of this corner
+      double c[4] = { node[0], h * node[1], h * node[2], h * h * node[3] };
+      double ux = hx[a], uxs = hx[2 + a], dux = dhx[a], duxs = dhx[2 + a];
+      double uy = hy[b], uys = hy[2 + b], duy = dhy[b], duys = dhy[2 + b];
+
+      f += c[0] * ux * uy + c[1] * uxs * uy + c[2] * ux * uys + c[3] * uxs * uys;
+      f_x += c[0] * dux * uy + c[1] * duxs * uy + c[2] * dux * uys + c[3] * duxs * uys;
+      f_y += c[0] * ux * duy + c[1] * uxs * duy + c[2] * ux * duys + c[3] * uxs * duys;
+    }
+  }
+
+  // chain rule from the unit cell to pressure
+  double ln10 = std::log(10.);
+  si = std::min(std::max(f, 0.), 1.);
+  dsi_dpc_liq = f_x * npoints_ / (pc_liq * ln10);
+  dsi_dpc_ice = f_y * npoints_ / (pc_ice * ln10);
+  return true;
+}
+
+
+int
+WRMImplicitPermafrostTable::num_valid_cells() const
+{
+  return std::count(valid_.begin(), valid_.end(), 1);
+}
+
+
 // Constructor
 WRMImplicitPermafrostModel::WRMImplicitPermafrostModel(Teuchos::ParameterList& plist)
-  : WRMPermafrostModel(plist)
+  : WRMPermafrostModel(plist), table_initialized_(false)
 {
   eps_ = plist_.get<double>("converged tolerance", 1.e-12);
   max_it_ = plist_.get<int>("max iterations", 100);
   deriv_regularization_ = plist_.get<double>("minimum dsi_dpressure magnitude", 1.e-10);
   solver_ = plist_.get<std::string>("solver algorithm", "brent");
+  use_table_ = plist_.get<bool>("use lookup table", false);
+}
+
+
+// Builds the table of s_i, once the WRM is known.
+void
+WRMImplicitPermafrostModel::InitializeTable_()
+{
+  double pc_min = plist_.get<double>("table minimum capillary pressure [Pa]", 1.);
+  double pc_max = plist_.get<double>("table maximum capillary pressure [Pa]", 1.e8);
+  double tol = plist_.get<double>("table error tolerance [-]", 1.e-8);
+  int npoints = plist_.get<int>("table points per decade", 8);
+  int npoints_max = plist_.get<int>("maximum table points per decade", 32);
+  if (pc_min <= 0. || pc_max <= pc_min || npoints < 1) {
+    Errors::Message emsg("WRMImplicitPermafrostModel: invalid table parameters, require 0 < "
+                         "minimum < maximum capillary pressure and at least one point per decade");
+    Exceptions::amanzi_throw(emsg);
+  }
+
+  auto f = [this](double pc_liq,
+                  double pc_ice,
+                  double& si,
+                  double& dsi_dpc_liq,
+                  double& dsi_dpc_ice) {
+    int max_it(max_it_);
+    si = SolveSatIce_(pc_liq, pc_ice, max_it);
+    if (max_it >= max_it_) return false;
+    dsi_dpc_liq = dsi_dpc_liq_frozen_unsaturated_nospline_(pc_liq, pc_ice, si);
+    dsi_dpc_ice = dsi_dpc_ice_frozen_unsaturated_nospline_(pc_liq, pc_ice, si);
+    return true;
+  };
+
+  // the root find must be used while building the table
+  use_table_ = false;
+  table_.Setup(f, pc_min, pc_max, tol, npoints, npoints_max);
+  use_table_ = true;
+  table_initialized_ = true;
+}
+
+
+bool
+WRMImplicitPermafrostModel::TableLookup_(double pc_liq,
+                                         double pc_ice,
+                                         double& si,
+                                         double& dsi_dpc_liq,
+                                         double& dsi_dpc_ice)
+{
+  if (!use_table_) return false;
+  if (!table_initialized_) InitializeTable_();
+  return table_.Evaluate(pc_liq, pc_ice, si, dsi_dpc_liq, dsi_dpc_ice);
 }
 
 // Above freezing calculation methods:
@@ -349,13 +567,34 @@ double
 WRMImplicitPermafrostModel::si_frozen_unsaturated_nospline_(double pc_liq,
                                                             double pc_ice,
                                                             bool throw_ok)
+{
+  double si, dsi_dpc_liq, dsi_dpc_ice;
+  if (TableLookup_(pc_liq, pc_ice, si, dsi_dpc_liq, dsi_dpc_ice)) return si;
+
+  int max_it(max_it_);
+  si = SolveSatIce_(pc_liq, pc_ice, max_it);
+
+  if (max_it >= max_it_) {
+    // did not converge?  May be ABS converged but not REL converged!
+    SatIceFunctor_ func(pc_liq, pc_ice, wrm_);
+    std::cerr << "WRMImplicitPermafrostModel did not converge, " << max_it
+              << " iterations, error = " << func(si) << ", s_i = " << si
+              << ", PC_{lg,il} = " << pc_liq << "," << pc_ice << std::endl;
+    if (throw_ok) { Exceptions::amanzi_throw(Errors::CutTimeStep()); }
+  }
+  return si;
+}
+
+
+// -- root find for si
+double
+WRMImplicitPermafrostModel::SolveSatIce_(double pc_liq, double pc_ice, int& max_it)
 {
   // solve implicit equation for s_i
   SatIceFunctor_ func(pc_liq, pc_ice, wrm_);
   double left = 0.;
   double right = 1.;
   double result(0.);
-  int max_it(max_it_);
 
   if (solver_ == "bisection") {
     Errors::Message emsg(
@@ -374,17 +613,8 @@ WRMImplicitPermafrostModel::si_frozen_unsaturated_nospline_(double pc_liq,
     Exceptions::amanzi_throw(emsg);
   }
 
-  double si = result;
-  AMANZI_ASSERT(0. <= si && si <= 1.);
-
-  if (max_it >= max_it_) {
-    // did not converge?  May be ABS converged but not REL converged!
-    std::cerr << "WRMImplicitPermafrostModel did not converge, " << max_it
-              << " iterations, error = " << func(si) << ", s_i = " << si
-              << ", PC_{lg,il} = " << pc_liq << "," << pc_ice << std::endl;
-    if (throw_ok) { Exceptions::amanzi_throw(Errors::CutTimeStep()); }
-  }
-  return si;
+  AMANZI_ASSERT(0. <= result && result <= 1.);
+  return result;
 }
 
 
@@ -394,6 +624,9 @@ WRMImplicitPermafrostModel::dsi_dpc_liq_frozen_unsaturated_nospline_(double pc_l
                                                                      double pc_ice,
                                                                      double si)
 {
+  double si_table, dsi_dpc_liq, dsi_dpc_ice;
+  if (TableLookup_(pc_liq, pc_ice, si_table, dsi_dpc_liq, dsi_dpc_ice)) return dsi_dpc_liq;
+
   // differentiate the implicit functor, solve for dsi_dpcliq
   double sstar = wrm_->saturation(pc_liq);
   double sstarprime = wrm_->d_saturation(pc_liq);
@@ -415,6 +648,9 @@ WRMImplicitPermafrostModel::dsi_dpc_ice_frozen_unsaturated_nospline_(double pc_l
                                                                      double pc_ice,
                                                                      double si)
 {
+  double si_table, dsi_dpc_liq, dsi_dpc_ice;
+  if (TableLookup_(pc_liq, pc_ice, si_table, dsi_dpc_liq, dsi_dpc_ice)) return dsi_dpc_ice;
+
   // differentiate the implicit functor, solve for dsi_dpcice
   double sstar = wrm_->saturation(pc_liq);
   double tmp = (1.0 - si) * sstar;
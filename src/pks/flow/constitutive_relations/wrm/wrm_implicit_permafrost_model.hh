@@ -16,12 +16,37 @@
     * `"converged tolerance`" ``[double]`` **1.e-12** Convergence tolerance of the implicit solve.
     * `"max iterations`" ``[int]`` **100** Maximum allowable iterations of the implicit solve.
     * `"solver algorithm [brent]`" ``[string]`` **brent** Only brent is currently supported.
+    * `"use lookup table`" ``[bool]`` **false** If true, ice saturation
+      (outside of the splined, nearly saturated region) and its derivatives
+      are interpolated from a table in (pc_liq, pc_ice) built the first time
+      the model is used, rather than found by a root find on every call.
+    * `"table minimum capillary pressure [Pa]`" ``[double]`` **1.** Lower
+      end of the table, in both capillary pressures.
+    * `"table maximum capillary pressure [Pa]`" ``[double]`` **1.e8** Upper
+      end of the table, in both capillary pressures.
+    * `"table error tolerance [-]`" ``[double]`` **1.e-8** Maximum absolute
+      interpolation error in ice saturation.
+    * `"table points per decade`" ``[int]`` **8** Initial resolution of the
+      table, doubled until the tolerance is met.
+    * `"maximum table points per decade`" ``[int]`` **32** Resolution at
+      which refinement stops.
+
+The table is a bicubic Hermite interpolant in the logarithms of the two
+capillary pressures, whose nodal derivatives are the exact derivatives of the
+implicit relation, so the Jacobian is consistent with the tabulated
+saturation.  Its error is checked against the root find at the center of each
+table cell.  Cells which do not meet the tolerance at the finest resolution,
+or where the root find did not converge, fall back to the root find, as do
+capillary pressures outside of the table.
 
 */
 
 #ifndef AMANZI_FLOWRELATIONS_WRM_IMPLICIT_PERMAFROST_MODEL_
 #define AMANZI_FLOWRELATIONS_WRM_IMPLICIT_PERMAFROST_MODEL_
 
+#include <functional>
+#include <vector>
+
 #include "wrm_permafrost_model.hh"
 #include "wrm_permafrost_factory.hh"
 
@@ -30,6 +55,48 @@ namespace Flow {
 
 class WRM;
 
+//
+// Bicubic Hermite table of s_i(pc_liq, pc_ice) on a grid uniform in
+// log10(pc_liq), log10(pc_ice).
+//
+class WRMImplicitPermafrostTable {
+ public:
+  // Evaluates s_i and its derivatives at a point, returning false if the
+  // solve failed there.
+  typedef std::function<
+    bool(double pc_liq, double pc_ice, double& si, double& dsi_dpc_liq, double& dsi_dpc_ice)>
+    NodeFunction;
+
+  // Builds the table, refining until tol is met or npoints_max per decade is
+  // reached.  Returns the maximum error over the valid cells.
+  double Setup(const NodeFunction& f,
+               double pc_min,
+               double pc_max,
+               double tol,
+               int npoints,
+               int npoints_max);
+
+  // Returns false if (pc_liq, pc_ice) is not in a valid cell of the table.
+  bool Evaluate(double pc_liq,
+                double pc_ice,
+                double& si,
+                double& dsi_dpc_liq,
+                double& dsi_dpc_ice) const;
+
+  int size() const { return n_; }
+  int num_valid_cells() const;
+
+ private:
+  double Build_(const NodeFunction& f, int npoints, double tol, bool invalidate);
+
+  int n_;         // nodes per dimension
+  int npoints_;   // nodes per decade
+  double x0_, pc_min_, pc_max_;
+  std::vector<double> nodes_; // f, f_x, f_y, f_xy per node, in log10 coordinates
+  std::vector<char> valid_;   // per cell
+};
+
+
 class WRMImplicitPermafrostModel : public WRMPermafrostModel {
  public:
   explicit WRMImplicitPermafrostModel(Teuchos::ParameterList& plist);
@@ -68,6 +135,17 @@ class WRMImplicitPermafrostModel : public WRMPermafrostModel {
   bool DetermineSplineCutoff_(double pc_liq, double pc_ice, double& cutoff, double& si);
   bool FitSpline_(double pc_ice, double cutoff, double si_cutoff, double (&coefs)[4]);
 
+  // root find for s_i, max_it is the number of iterations taken on return
+  double SolveSatIce_(double pc_liq, double pc_ice, int& max_it);
+
+  // table lookup, false if not using or outside of the table
+  bool TableLookup_(double pc_liq,
+                    double pc_ice,
+                    double& si,
+                    double& dsi_dpc_liq,
+                    double& dsi_dpc_ice);
+  void InitializeTable_();
+
 
  protected:
   double eps_;
@@ -75,6 +153,10 @@ class WRMImplicitPermafrostModel : public WRMPermafrostModel {
   double deriv_regularization_;
   std::string solver_;
 
+  bool use_table_;
+  bool table_initialized_;
+  WRMImplicitPermafrostTable table_;
+
  private:
   // Functor for ice saturation, gets used within a root-finding algorithm
   class SatIceFunctor_ {
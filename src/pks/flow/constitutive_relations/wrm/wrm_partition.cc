@@ -15,11 +15,31 @@
 #include "wrm_factory.hh"
 #include "wrm_permafrost_factory.hh"
 #include "wrm_partition.hh"
+#include "BoundaryFaceMap.hh"
 
 
 namespace Amanzi {
 namespace Flow {
 
+void
+WRMPartitionIndices::Initialize(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                                const Relations::BoundaryFaceMap& bf_map,
+                                const Functions::MeshPartition& partition,
+                                int nregions)
+{
+  cells.assign(nregions, std::vector<int>());
+  bfaces.assign(nregions, std::vector<int>());
+
+  int ncells = mesh->getNumEntities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+  for (int c = 0; c != ncells; ++c) cells[partition[c]].push_back(c);
+
+  // given a boundary face, we need the internal cell to choose the right WRM
+  bface_map = &bf_map;
+  int nbfaces = bface_map->cell.size();
+  for (int bf = 0; bf != nbfaces; ++bf) bfaces[partition[bface_map->cell[bf]]].push_back(bf);
+}
+
+
 // Non-member factory
 Teuchos::RCP<WRMPartition>
 createWRMPartition(Teuchos::ParameterList& plist)
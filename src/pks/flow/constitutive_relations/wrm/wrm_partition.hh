@@ -31,6 +31,11 @@ the mesh.
 #include "MeshPartition.hh"
 
 namespace Amanzi {
+
+namespace Relations {
+struct BoundaryFaceMap;
+}
+
 namespace Flow {
 
 typedef std::vector<Teuchos::RCP<WRM>> WRMList;
@@ -40,6 +45,24 @@ typedef std::vector<Teuchos::RCP<WRMPermafrostModel>> WRMPermafrostModelList;
 typedef std::pair<Teuchos::RCP<Functions::MeshPartition>, WRMPermafrostModelList>
   WRMPermafrostModelPartition;
 
+//
+// Owned cells and owned boundary faces grouped by the region of a partition
+// in which they (or, for boundary faces, their interior cell) lie, so that
+// each region's model can be evaluated in one batched call.
+//
+struct WRMPartitionIndices {
+  void Initialize(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                  const Relations::BoundaryFaceMap& bf_map,
+                  const Functions::MeshPartition& partition,
+                  int nregions);
+  bool initialized() const { return !cells.empty(); }
+
+  std::vector<std::vector<int>> cells;  // owned cells in each region
+  std::vector<std::vector<int>> bfaces; // owned boundary faces in each region
+  const Relations::BoundaryFaceMap* bface_map = nullptr; // bf -> f, cell maps, owned by State
+};
+
+
 // Non-member factory
 Teuchos::RCP<WRMPartition>
 createWRMPartition(Teuchos::ParameterList& plist);
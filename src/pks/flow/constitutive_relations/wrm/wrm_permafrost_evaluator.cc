@@ -15,6 +15,8 @@
 
 #include "wrm_permafrost_evaluator.hh"
 #include "wrm_partition.hh"
+#include "BoundaryFaceMap.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -137,9 +139,19 @@ WRMPermafrostEvaluator::InitializeFromPlist_()
 }
 
 
+// Structure is the same for all keys; boundary faces need the map of the mesh.
+void
+WRMPermafrostEvaluator::EnsureCompatibility_Structure_(State& S)
+{
+  EnsureCompatibility_StructureSame_(S);
+  Relations::requireBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first));
+}
+
+
 void
 WRMPermafrostEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   // Initialize the MeshPartition
   if (!permafrost_models_->first->initialized()) {
     permafrost_models_->first->Initialize(results[0]->Mesh(), -1);
@@ -178,19 +190,16 @@ WRMPermafrostEvaluator::Evaluate_(const State& S, const std::vector<CompositeVec
       *S.GetPtr<CompositeVector>(pc_ice_key_, tag)->ViewComponent("boundary_face", false);
 
     // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = results[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->getMap(AmanziMesh::Entity_kind::BOUNDARY_FACE, false);
-    const Epetra_Map& face_map = mesh->getMap(AmanziMesh::Entity_kind::FACE, false);
+    const auto& bf_cell =
+      Relations::getBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first)).cell;
 
     // calculate boundary face values
     int nbfaces = satg_bf.MyLength();
     for (int bf = 0; bf != nbfaces; ++bf) {
       // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      auto cells = mesh->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
+      AmanziMesh::Entity_ID c = bf_cell[bf];
 
-      int i = (*permafrost_models_->first)[cells[0]];
+      int i = (*permafrost_models_->first)[c];
       permafrost_models_->second[i]->saturations(pc_liq_bf[0][bf], pc_ice_bf[0][bf], sats);
       satg_bf[0][bf] = sats[0];
       satl_bf[0][bf] = sats[1];
@@ -206,6 +215,7 @@ WRMPermafrostEvaluator::EvaluatePartialDerivative_(const State& S,
                                                    const Tag& wrt_tag,
                                                    const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // Initialize the MeshPartition
   if (!permafrost_models_->first->initialized()) {
     permafrost_models_->first->Initialize(results[0]->Mesh(), -1);
@@ -260,20 +270,17 @@ WRMPermafrostEvaluator::EvaluatePartialDerivative_(const State& S,
       *S.GetPtr<CompositeVector>(pc_ice_key_, tag)->ViewComponent("boundary_face", false);
 
     // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = results[0]->Mesh();
-    const Epetra_Map& face_map = mesh->getMap(AmanziMesh::Entity_kind::FACE, false);
-    const Epetra_Map& vandelay_map = mesh->getMap(AmanziMesh::Entity_kind::BOUNDARY_FACE, false);
+    const auto& bf_cell =
+      Relations::getBoundaryFaceMap(S, Keys::getDomain(my_keys_.front().first)).cell;
 
     if (wrt_key == pc_liq_key_) {
       // calculate boundary face values
       int nbfaces = satl_bf.MyLength();
       for (int bf = 0; bf != nbfaces; ++bf) {
         // given a boundary face, we need the internal cell to choose the right WRM
-        AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-        auto cells = mesh->getFaceCells(f);
-        AMANZI_ASSERT(cells.size() == 1);
+        AmanziMesh::Entity_ID c = bf_cell[bf];
 
-        int i = (*permafrost_models_->first)[cells[0]];
+        int i = (*permafrost_models_->first)[c];
         permafrost_models_->second[i]->dsaturations_dpc_liq(
           pc_liq_bf[0][bf], pc_ice_bf[0][bf], dsats);
         satg_bf[0][bf] = dsats[0];
@@ -286,11 +293,9 @@ WRMPermafrostEvaluator::EvaluatePartialDerivative_(const State& S,
       int nbfaces = satl_bf.MyLength();
       for (int bf = 0; bf != nbfaces; ++bf) {
         // given a boundary face, we need the internal cell to choose the right WRM
-        AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-        auto cells = mesh->getFaceCells(f);
-        AMANZI_ASSERT(cells.size() == 1);
+        AmanziMesh::Entity_ID c = bf_cell[bf];
 
-        int i = (*permafrost_models_->first)[cells[0]];
+        int i = (*permafrost_models_->first)[c];
         permafrost_models_->second[i]->dsaturations_dpc_ice(
           pc_liq_bf[0][bf], pc_ice_bf[0][bf], dsats);
         satg_bf[0][bf] = dsats[0];
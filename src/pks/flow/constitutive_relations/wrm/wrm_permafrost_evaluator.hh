@@ -45,10 +45,7 @@ class WRMPermafrostEvaluator : public EvaluatorSecondaryMonotypeCV {
                                           const Tag& wrt_tag,
                                           const std::vector<CompositeVector*>& results) override;
 
-  virtual void EnsureCompatibility_Structure_(State& S) override
-  {
-    EnsureCompatibility_StructureSame_(S);
-  }
+  virtual void EnsureCompatibility_Structure_(State& S) override;
 
   void InitializeFromPlist_();
 
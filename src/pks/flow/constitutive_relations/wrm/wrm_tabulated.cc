@@ -0,0 +1,178 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Lookup-table acceleration of any other WRM.
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "errors.hh"
+#include "wrm_factory.hh"
+#include "wrm_tabulated.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+/* ******************************************************************
+* Builds the interpolant of f on [x_max / 2^noctaves, x_max], using the derivative df
+* limited to preserve monotonicity (Fritsch & Carlson, 1980).
+****************************************************************** */
+void
+WRMTabulatedCurve::Setup(const std::function<double(double)>& f,
+                         const std::function<double(double)>& df,
+                         double x_max,
+                         int noctaves,
+                         int npoints)
+{
+  npoints_ = npoints;
+  x_max_ = x_max;
+  x0_ = std::ldexp(x_max, -noctaves);
+  inv_x0_ = 1. / x0_;
+
+  int n = npoints * noctaves;
+  std::vector<double> x(n + 1), y(n + 1), m(n + 1);
+  for (int k = 0; k <= n; ++k) {
+    x[k] = Node_(k);
+    y[k] = f(x[k]);
+    m[k] = df(x[k]);
+  }
+
+  for (int k = 0; k < n; ++k) {
+    double delta = (y[k + 1] - y[k]) / (x[k + 1] - x[k]);
+    if (!std::isfinite(m[k])) m[k] = 3 * delta;
+    if (!std::isfinite(m[k + 1])) m[k + 1] = 3 * delta;
+
+    if (delta == 0.) {
+      m[k] = 0.;
+      m[k + 1] = 0.;
+    } else {
+      double alpha = m[k] / delta;
+      double beta = m[k + 1] / delta;
+      if (alpha < 0.) {
+        alpha = 0.;
+        m[k] = 0.;
+      }
+      if (beta < 0.) {
+        beta = 0.;
+        m[k + 1] = 0.;
+      }
+      double norm2 = alpha * alpha + beta * beta;
+      if (norm2 > 9.) {
+        double tau = 3. / std::sqrt(norm2);
+        m[k] = tau * alpha * delta;
+        m[k + 1] = tau * beta * delta;
+      }
+    }
+  }
+
+  coefs_.resize(4 * n);
+  inv_h_.resize(n);
+  for (int k = 0; k < n; ++k) {
+    double h = x[k + 1] - x[k];
+    double* a = &coefs_[4 * k];
+    a[0] = y[k];
+    a[1] = h * m[k];
+    a[2] = 3 * (y[k + 1] - y[k]) - 2 * h * m[k] - h * m[k + 1];
+    a[3] = 2 * (y[k] - y[k + 1]) + h * m[k] + h * m[k + 1];
+    inv_h_[k] = 1. / h;
+  }
+}
+
+
+/* ******************************************************************
+* Location of the k-th node.
+****************************************************************** */
+double
+WRMTabulatedCurve::Node_(int k) const
+{
+  return std::ldexp(x0_, k / npoints_) * (1. + (double)(k % npoints_) / npoints_);
+}
+
+
+/* ******************************************************************
+* Interpolation error at the quarter points of every interval.
+****************************************************************** */
+double
+WRMTabulatedCurve::MaxError(const std::function<double(double)>& f) const
+{
+  double error = 0.;
+  for (int k = 0; k != size(); ++k) {
+    double x0 = Node_(k);
+    double h = Node_(k + 1) - x0;
+    for (double t : { 0.25, 0.5, 0.75 }) {
+      double x = x0 + t * h;
+      double fx = f(x);
+      if (std::isfinite(fx)) error = std::max(error, std::abs(Value(x) - fx));
+    }
+  }
+  return error;
+}
+
+
+/* ******************************************************************
+* Setup fundamental parameters for this model.
+****************************************************************** */
+WRMTabulated::WRMTabulated(Teuchos::ParameterList& plist) : plist_(plist)
+{
+  InitializeFromPlist_();
+};
+
+
+void
+WRMTabulated::InitializeFromPlist_()
+{
+  std::string params_name = plist_.get<std::string>("model parameters", "WRM parameters");
+  Teuchos::ParameterList& sublist = plist_.sublist(params_name);
+
+  WRMFactory fac;
+  wrm_ = fac.createWRM(sublist);
+
+  double pc_max = plist_.get<double>("maximum capillary pressure [Pa]", 1.e8);
+  double tol = plist_.get<double>("table error tolerance [-]", 1.e-6);
+  int npoints = plist_.get<int>("table points per octave", 16);
+  int npoints_max = plist_.get<int>("maximum table points per octave", 1024);
+
+  // Tables span pc in [pc_max * 2^-60, pc_max) and 1 - s in [2^-40, 1); closer
+  // to saturation, 1 - s cannot be resolved in double precision.
+  const int noctaves_sat = 60;
+  const int noctaves_kr = 40;
+
+  auto sat = [this](double pc) { return wrm_->saturation(pc); };
+  auto dsat = [this](double pc) { return wrm_->d_saturation(pc); };
+  auto kr = [this](double t) { return wrm_->k_relative(1. - t); };
+  auto dkr = [this](double t) { return -wrm_->d_k_relative(1. - t); };
+
+  auto build = [&](WRMTabulatedCurve& curve,
+                   const std::function<double(double)>& f,
+                   const std::function<double(double)>& df,
+                   double x_max,
+                   int noctaves,
+                   const std::string& name) {
+    double error = 0.;
+    for (int n = npoints; n <= npoints_max; n *= 2) {
+      curve.Setup(f, df, x_max, noctaves, n);
+      error = curve.MaxError(f);
+      if (error <= tol) return;
+    }
+    Errors::Message msg;
+    msg << "WRM tabulated: table of " << name << " in list \"" << plist_.name()
+        << "\" has error " << error << " with " << npoints_max
+        << " points per octave, above the tolerance " << tol
+        << ".  Consider smoothing the wrapped WRM or loosening \"table error tolerance [-]\".";
+    Exceptions::amanzi_throw(msg);
+  };
+
+  build(sat_, sat, dsat, pc_max, noctaves_sat, "saturation");
+  build(kr_, kr, dkr, 1., noctaves_kr, "relative permeability");
+}
+
+} // namespace Flow
+} // namespace Amanzi
@@ -0,0 +1,182 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! WRMTabulated : lookup-table acceleration of any other WRM.
+/*!
+
+Wraps another WRM, replacing the evaluation of saturation, relative
+permeability, and their derivatives by interpolation in a table built at
+construction.  The table is a monotone (Fritsch-Carlson limited) piecewise
+cubic Hermite interpolant of the wrapped model, and derivatives are the exact
+derivatives of that interpolant, so the Jacobian is consistent with the
+residual.
+
+Nodes are uniformly spaced within each binary octave of capillary pressure
+(for saturation) and of 1 - saturation (for relative permeability), which
+resolves the power-law behavior of typical WRMs near both ends of the curve
+with a modest number of nodes.  The tables are refined until the
+interpolation error, measured against the wrapped model at interior points of
+every interval, is below the requested tolerance; if that is not possible the
+constructor throws.
+
+Capillary pressure and suction head are always evaluated by the wrapped
+model, as is anything outside of the tables: capillary pressures above the
+maximum or below 2^-60 times the maximum, and saturations within 1e-12 of one
+(notably saturated cells).
+
+.. _WRM-tabulated-spec:
+.. admonition:: WRM-tabulated-spec
+
+    * `"model parameters`" ``[string]`` **"WRM parameters"** Name of the
+      sublist containing the wrapped WRM's spec, including its `"wrm type`".
+    * `"maximum capillary pressure [Pa]`" ``[double]`` **1.e8** Upper end of
+      the saturation table.
+    * `"table error tolerance [-]`" ``[double]`` **1.e-6** Maximum absolute
+      interpolation error in saturation and relative permeability.
+    * `"table points per octave`" ``[int]`` **16** Initial resolution,
+      doubled until the tolerance is met.
+    * `"maximum table points per octave`" ``[int]`` **1024** Resolution at
+      which refinement gives up.
+
+Example:
+
+.. code-block:: xml
+
+    <ParameterList name="moss" type="ParameterList">
+      <Parameter name="region" type="string" value="moss" />
+      <Parameter name="wrm type" type="string" value="tabulated" />
+      <Parameter name="table error tolerance [-]" type="double" value="1.e-7" />
+      <ParameterList name="WRM parameters" type="ParameterList">
+        <Parameter name="wrm type" type="string" value="van Genuchten" />
+        <Parameter name="van Genuchten alpha [Pa^-1]" type="double" value="0.002" />
+        <Parameter name="van Genuchten m [-]" type="double" value="0.2" />
+        <Parameter name="residual saturation [-]" type="double" value="0.0" />
+        <Parameter name="smoothing interval width [saturation]" type="double" value=".05" />
+      </ParameterList>
+    </ParameterList>
+
+*/
+
+#ifndef ATS_FLOWRELATIONS_WRM_TABULATED_
+#define ATS_FLOWRELATIONS_WRM_TABULATED_
+
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "wrm.hh"
+#include "Factory.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+//
+// Piecewise cubic Hermite interpolant on [x0, x_max], with x_max = x0 *
+// 2^noctaves and nodes uniformly spaced within each octave [x0 * 2^k, x0 *
+// 2^(k+1)).
+//
+class WRMTabulatedCurve {
+ public:
+  void Setup(const std::function<double(double)>& f,
+             const std::function<double(double)>& df,
+             double x_max,
+             int noctaves,
+             int npoints);
+
+  // maximum absolute error versus f at interior points of every interval
+  double MaxError(const std::function<double(double)>& f) const;
+
+  bool InRange(double x) const { return x >= x0_ && x < x_max_; }
+  double x_max() const { return x_max_; }
+  int size() const { return inv_h_.size(); }
+
+  double Value(double x) const
+  {
+    double t;
+    const double* a = &coefs_[4 * Interval_(x, t)];
+    return a[0] + t * (a[1] + t * (a[2] + t * a[3]));
+  }
+
+  double Derivative(double x) const
+  {
+    double t;
+    int i = Interval_(x, t);
+    const double* a = &coefs_[4 * i];
+    return (a[1] + t * (2 * a[2] + t * 3 * a[3])) * inv_h_[i];
+  }
+
+ private:
+  // Interval containing x, which must be InRange, and the local coordinate
+  // t in [0,1] of x within it.
+  int Interval_(double x, double& t) const
+  {
+    int e;
+    double mant = std::frexp(x * inv_x0_, &e); // x / x0 = mant * 2^e, mant in [0.5,1)
+    double y = (2 * mant - 1) * npoints_;
+    int j = std::min((int)y, npoints_ - 1);
+    t = y - j;
+    return (e - 1) * npoints_ + j;
+  }
+
+  double Node_(int k) const;
+
+  int npoints_;
+  double x0_, inv_x0_, x_max_;
+  std::vector<double> coefs_; // cubic in local coordinate, 4 per interval
+  std::vector<double> inv_h_;
+};
+
+
+class WRMTabulated : public WRMBatched<WRMTabulated> {
+ public:
+  explicit WRMTabulated(Teuchos::ParameterList& plist);
+
+  // required methods from the base class
+  double k_relative(double s)
+  {
+    double t = 1. - s;
+    return kr_.InRange(t) ? kr_.Value(t) : wrm_->k_relative(s);
+  }
+  double d_k_relative(double s)
+  {
+    double t = 1. - s;
+    return kr_.InRange(t) ? -kr_.Derivative(t) : wrm_->d_k_relative(s);
+  }
+  double saturation(double pc) { return sat_.InRange(pc) ? sat_.Value(pc) : wrm_->saturation(pc); }
+  double d_saturation(double pc)
+  {
+    return sat_.InRange(pc) ? sat_.Derivative(pc) : wrm_->d_saturation(pc);
+  }
+  double capillaryPressure(double s) { return wrm_->capillaryPressure(s); }
+  double d_capillaryPressure(double s) { return wrm_->d_capillaryPressure(s); }
+  double residualSaturation() { return wrm_->residualSaturation(); }
+  double suction_head(double s) { return wrm_->suction_head(s); }
+  double d_suction_head(double s) { return wrm_->d_suction_head(s); }
+
+  // access to the wrapped model, e.g. for comparison
+  Teuchos::RCP<WRM> get_model() { return wrm_; }
+
+ private:
+  void InitializeFromPlist_();
+
+  Teuchos::ParameterList plist_;
+  Teuchos::RCP<WRM> wrm_;
+
+  WRMTabulatedCurve sat_; // saturation as a function of pc
+  WRMTabulatedCurve kr_;  // rel perm as a function of 1 - saturation
+
+  static Utils::RegisteredFactory<WRM, WRMTabulated> factory_;
+};
+
+} // namespace Flow
+} // namespace Amanzi
+
+#endif
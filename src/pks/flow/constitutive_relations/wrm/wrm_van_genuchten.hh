@@ -60,7 +60,7 @@ Example:
 namespace Amanzi {
 namespace Flow {
 
-class WRMVanGenuchten : public WRM {
+class WRMVanGenuchten : public WRMBatched<WRMVanGenuchten> {
  public:
   explicit WRMVanGenuchten(Teuchos::ParameterList& plist);
 
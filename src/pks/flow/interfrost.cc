@@ -9,6 +9,7 @@
 
 #include "Op.hh"
 #include "interfrost.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -43,6 +44,7 @@ Interfrost::AddAccumulation_(const Teuchos::Ptr<CompositeVector>& g)
 void
 Interfrost::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
@@ -27,6 +27,7 @@
 #include "UpwindFluxFactory.hh"
 
 #include "pk_helpers.hh"
+#include "reductions.hh"
 
 #include "overland_pressure.hh"
 
@@ -1044,18 +1045,18 @@ OverlandPressureFlow::UpdateBoundaryConditions_(const Tag& tag)
 
   // check that there are no internal faces and mark all remaining boundary
   // conditions as the default, zero flux conditions
-  int nfaces_owned =
-    mesh_->getNumEntities(AmanziMesh::Entity_kind::FACE, AmanziMesh::Parallel_kind::OWNED);
+  const auto& face_cells = FaceCells_();
+  int nfaces_owned = face_cells.size() / 2;
   for (int f = 0; f != nfaces_owned; ++f) {
-    auto cells = mesh_->getFaceCells(f);
-    int ncells = cells.size();
-
-    if ((markers[f] != Operators::OPERATOR_BC_NONE) && (ncells == 2)) {
+    if ((markers[f] != Operators::OPERATOR_BC_NONE) &&
+        (face_cells[2 * f] != face_cells[2 * f + 1])) {
       Errors::Message msg("Tried to set a boundary condition on internal face GID ");
       msg << mesh_->getMap(AmanziMesh::Entity_kind::FACE, false).GID(f);
       Exceptions::amanzi_throw(msg);
     }
-    if ((markers[f] == Operators::OPERATOR_BC_NONE) && (ncells == 1)) {
+  }
+  for (auto f : BoundaryFaces_()) {
+    if (markers[f] == Operators::OPERATOR_BC_NONE) {
       markers[f] = Operators::OPERATOR_BC_NEUMANN;
       values[f] = 0.0;
     }
@@ -1251,13 +1252,13 @@ OverlandPressureFlow::ModifyCorrection(double h,
   }
 
   // debugging -- remove me! --etc
-  for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
-       ++comp) {
-    Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
-    double max, l2;
-    du_c.NormInf(&max);
-    du_c.Norm2(&l2);
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
+         ++comp) {
+      Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
+      double max, l2;
+      du_c.NormInf(&max);
+      du_c.Norm2(&l2);
       *vo_->os() << "Linf, L2 pressure correction (" << *comp << ") = " << max << ", " << l2
                  << std::endl;
     }
@@ -1265,8 +1266,7 @@ OverlandPressureFlow::ModifyCorrection(double h,
 
   // limit by capping corrections when they cross atmospheric pressure
   // (where pressure derivatives are discontinuous)
-  int my_limited = 0;
-  int n_limited_spurt = 0;
+  int my_limited_spurt = 0;
   if (patm_limit_ > 0.) {
     double patm = S_->Get<double>("atmospheric_pressure", Tags::DEFAULT);
 
@@ -1276,13 +1276,12 @@ OverlandPressureFlow::ModifyCorrection(double h,
     for (int c = 0; c != du_c.MyLength(); ++c) {
       if ((u_c[0][c] < patm) && (u_c[0][c] - du_c[0][c] > patm + patm_limit_)) {
         du_c[0][c] = u_c[0][c] - (patm + patm_limit_);
-        my_limited++;
+        my_limited_spurt++;
       } else if ((u_c[0][c] > patm) && (u_c[0][c] - du_c[0][c] < patm - patm_limit_)) {
         du_c[0][c] = u_c[0][c] - (patm - patm_limit_);
-        my_limited++;
+        my_limited_spurt++;
       }
     }
-    mesh_->getComm()->MaxAll(&my_limited, &n_limited_spurt, 1);
   }
 
   if (patm_hard_limit_) {
@@ -1294,14 +1293,9 @@ OverlandPressureFlow::ModifyCorrection(double h,
     for (int c = 0; c != du_c.MyLength(); ++c) {
       if (u_c[0][c] - du_c[0][c] < patm) {
         du_c[0][c] = u_c[0][c] - patm;
-        my_limited++;
+        my_limited_spurt++;
       }
     }
-    mesh_->getComm()->MaxAll(&my_limited, &n_limited_spurt, 1);
-  }
-
-  if (n_limited_spurt > 0) {
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) { *vo_->os() << "  limiting the spurt." << std::endl; }
   }
 
   // debugging -- remove me! --etc
@@ -1318,48 +1312,59 @@ OverlandPressureFlow::ModifyCorrection(double h,
   }
 
   // Limit based on a max pressure change
-  my_limited = 0;
-  int n_limited_change = 0;
-
+  int my_limited_change = 0;
   if (p_limit_ > 0.) {
     for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
          ++comp) {
       Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
 
-      double max;
-      du_c.NormInf(&max);
       if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+        double max;
+        du_c.NormInf(&max);
         *vo_->os() << "Max overland pressure correction (" << *comp << ") = " << max << std::endl;
       }
 
       for (int c = 0; c != du_c.MyLength(); ++c) {
         if (std::abs(du_c[0][c]) > p_limit_) {
           du_c[0][c] = ((du_c[0][c] > 0) - (du_c[0][c] < 0)) * p_limit_;
-          my_limited++;
+          my_limited_change++;
         }
       }
     }
-
-    mesh_->getComm()->SumAll(&my_limited, &n_limited_change, 1);
-  }
-
-  if (n_limited_change > 0) {
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) { *vo_->os() << "  limited by pressure." << std::endl; }
   }
 
   // debugging -- remove me! --etc
-  for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
-       ++comp) {
-    Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
-    double max, l2;
-    du_c.NormInf(&max);
-    du_c.Norm2(&l2);
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
+         ++comp) {
+      Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
+      double max, l2;
+      du_c.NormInf(&max);
+      du_c.Norm2(&l2);
       *vo_->os() << "Linf, L2 pressure correction (" << *comp << ") = " << max << ", " << l2
                  << std::endl;
     }
   }
 
+  // all limiters are reduced together
+  int n_limited_spurt = 0;
+  int n_limited_change = 0;
+  if (patm_limit_ > 0. || patm_hard_limit_ || p_limit_ > 0.) {
+    Reductions reductions(mesh_->getComm());
+    int spurt_handle = reductions.Max(my_limited_spurt);
+    int change_handle = reductions.Sum(my_limited_change);
+    reductions.Reduce();
+    n_limited_spurt = reductions[spurt_handle];
+    n_limited_change = reductions[change_handle];
+  }
+
+  if (n_limited_spurt > 0) {
+    if (vo_->os_OK(Teuchos::VERB_HIGH)) { *vo_->os() << "  limiting the spurt." << std::endl; }
+  }
+  if (n_limited_change > 0) {
+    if (vo_->os_OK(Teuchos::VERB_HIGH)) { *vo_->os() << "  limited by pressure." << std::endl; }
+  }
+
   if (n_limited_spurt > 0) {
     return AmanziSolvers::FnBaseDefs::CORRECTION_MODIFIED_LAG_BACKTRACKING;
   } else if (n_limited_change > 0) {
@@ -9,6 +9,7 @@
 
 #include "overland_pressure.hh"
 #include "Op.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -26,6 +27,7 @@ OverlandPressureFlow::FunctionalResidual(double t_old,
                                          Teuchos::RCP<TreeVector> u_new,
                                          Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
 
@@ -120,6 +122,7 @@ int
 OverlandPressureFlow::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
                                           Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon application:" << std::endl;
   AMANZI_ASSERT(!precon_scaled_); // otherwise this factor was built into the matrix
@@ -149,6 +152,7 @@ OverlandPressureFlow::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
 void
 OverlandPressureFlow::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon update at t = " << t << std::endl;
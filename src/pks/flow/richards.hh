@@ -100,6 +100,25 @@ Solves Richards equation:
      - `"arithmetic mean`" Face value is the mean of the neighboring
        cells.  Not a good method.
 
+   * `"flux direction method`" ``[string]`` **operator** When upwinding with
+     Darcy flux, the direction of the flux is recomputed whenever pressure
+     changes.  One of:
+
+     - `"operator`" Assembles a second diffusion operator and computes its
+       flux.  This is exact, but costs roughly as much as the residual's own
+       diffusion operator.
+     - `"two-point estimate`" Uses a two-point flux approximation of the
+       potential difference across each face, with the normal component of
+       the absolute permeability.  Geometry and permeability are cached until
+       the mesh deforms.  This is cheap, and exact for K-orthogonal meshes,
+       but may differ in sign on faces where the flux is near zero.
+
+   * `"check flux direction estimate`" ``[bool]`` **false** If true, computes
+     both the operator's flux and the two-point estimate, upwinds with the
+     operator's flux, and reports the number of faces whose directions
+     differ.  Used to decide whether the estimate is good enough for a given
+     mesh.
+
    Globalization and other process-based hacks:
 
    * `"modify predictor with consistent faces`" ``[bool]`` **false** In a
@@ -312,6 +331,8 @@ class Richards : public PK_PhysicalBDF_Default {
   virtual void SetAbsolutePermeabilityTensor_(const Tag& tag);
   virtual bool UpdatePermeabilityData_(const Tag& tag);
   virtual bool UpdatePermeabilityDerivativeData_(const Tag& tag);
+  virtual void BuildFluxDirectionEstimate_();
+  virtual void EstimateFluxDirection_(const Tag& tag, CompositeVector& flux_dir);
 
   virtual void UpdateVelocity_(const Tag& tag);
   virtual void InitializeHydrostatic_(const Tag& tag);
@@ -361,6 +382,8 @@ class Richards : public PK_PhysicalBDF_Default {
   bool explicit_source_;
   std::string clobber_policy_;
   bool clobber_boundary_flux_dir_;
+  bool estimate_flux_dir_;
+  bool check_flux_dir_estimate_;
 
   // coupling terms
   bool coupled_to_surface_via_head_; // surface-subsurface Dirichlet coupler
@@ -385,6 +408,15 @@ class Richards : public PK_PhysicalBDF_Default {
   Teuchos::RCP<Operators::PDE_DiffusionWithGravity> matrix_diff_;
   Teuchos::RCP<Operators::PDE_DiffusionWithGravity> preconditioner_diff_;
   Teuchos::RCP<Operators::PDE_DiffusionWithGravity> face_matrix_diff_;
+
+  // two-point estimate of the flux direction, on owned faces
+  struct FluxDirFace {
+    AmanziMesh::Entity_ID c0, c1; // c1 is -1 on boundary faces
+    int dir;                      // orientation of the face relative to c0
+    double trans;                 // two-point transmissibility, to c1 or the face
+    double gdx;                   // g . (x_c0 - x_c1), or to the face centroid
+  };
+  std::vector<FluxDirFace> flux_dir_faces_;
   Teuchos::RCP<Operators::PDE_Accumulation> preconditioner_acc_;
 
   // flag to do jacobian and therefore coef derivs
@@ -12,6 +12,7 @@
 
 #include "Evaluator.hh"
 #include "Op.hh"
+#include "OperatorDefs.hh"
 
 #include "pk_helpers.hh"
 #include "richards.hh"
@@ -178,6 +179,109 @@ Richards::SetAbsolutePermeabilityTensor_(const Tag& tag)
 };
 
 
+// -------------------------------------------------------------
+// Cache the geometry and transmissibilities of the two-point
+// estimate of the flux direction.
+// -------------------------------------------------------------
+void
+Richards::BuildFluxDirectionEstimate_()
+{
+  S_->GetEvaluator(perm_key_, tag_next_).Update(*S_, name_);
+  const CompositeVector& perm = S_->Get<CompositeVector>(perm_key_, tag_next_);
+  perm.ScatterMasterToGhosted("cell");
+  const Epetra_MultiVector& perm_c = *perm.ViewComponent("cell", true);
+  const AmanziGeometry::Point& gravity = S_->Get<AmanziGeometry::Point>("gravity", Tags::DEFAULT);
+  int space_dim = mesh_->getSpaceDimension();
+  int ndofs = perm_c.NumVectors();
+
+  // n^T K n, for a cell's permeability, as in SetAbsolutePermeabilityTensor_()
+  auto normal_perm = [&](int c, const AmanziGeometry::Point& n) {
+    double k = 0.;
+    if (ndofs == 1) {
+      k = perm_c[0][c] * (n * n);
+    } else if (ndofs == 2 && space_dim == 3) {
+      k = perm_c[0][c] * (n[0] * n[0] + n[1] * n[1]) + perm_c[1][c] * n[2] * n[2];
+    } else {
+      for (int dim = 0; dim != space_dim; ++dim) k += perm_c[dim][c] * n[dim] * n[dim];
+      if (ndofs == 3 && space_dim == 2) {
+        k += 2 * perm_c[2][c] * n[0] * n[1];
+      } else if (ndofs == 6) {
+        k += 2 * (perm_c[3][c] * n[0] * n[1] + perm_c[4][c] * n[0] * n[2] +
+                  perm_c[5][c] * n[1] * n[2]);
+      }
+    }
+    return k * perm_scale_;
+  };
+
+  int nfaces =
+    mesh_->getNumEntities(AmanziMesh::Entity_kind::FACE, AmanziMesh::Parallel_kind::OWNED);
+  flux_dir_faces_.resize(nfaces);
+  for (int f = 0; f != nfaces; ++f) {
+    FluxDirFace& face = flux_dir_faces_[f];
+    auto cells = mesh_->getFaceCells(f);
+    face.c0 = cells[0];
+    face.c1 = cells.size() > 1 ? cells[1] : -1;
+
+    // the normal is outward from c0, and its norm is the face area
+    const AmanziGeometry::Point normal = mesh_->getFaceNormal(f, face.c0, &face.dir);
+    double area = AmanziGeometry::norm(normal);
+    AmanziGeometry::Point unit = normal / area;
+    const AmanziGeometry::Point& xf = mesh_->getFaceCentroid(f);
+    const AmanziGeometry::Point& x0 = mesh_->getCellCentroid(face.c0);
+
+    // half transmissibilities, A k_n / d
+    double t0 = area * normal_perm(face.c0, unit) / std::abs(unit * (xf - x0));
+    if (face.c1 < 0) {
+      face.trans = t0;
+      face.gdx = gravity * (x0 - xf);
+    } else {
+      const AmanziGeometry::Point& x1 = mesh_->getCellCentroid(face.c1);
+      double t1 = area * normal_perm(face.c1, unit) / std::abs(unit * (xf - x1));
+      face.trans = (t0 + t1 > 0.) ? t0 * t1 / (t0 + t1) : 0.;
+      face.gdx = gravity * (x0 - x1);
+    }
+  }
+}
+
+
+// -------------------------------------------------------------
+// Two-point estimate of the Darcy flux, whose sign is used in
+// place of the face operator's flux for upwinding.
+//
+//   K_f (p_0 - p_1 - rho_f g . (x_0 - x_1))
+// -------------------------------------------------------------
+void
+Richards::EstimateFluxDirection_(const Tag& tag, CompositeVector& flux_dir)
+{
+  if (flux_dir_faces_.empty()) BuildFluxDirectionEstimate_();
+
+  const CompositeVector& pres = S_->Get<CompositeVector>(key_, tag);
+  const CompositeVector& rho = S_->Get<CompositeVector>(mass_dens_key_, tag);
+  pres.ScatterMasterToGhosted("cell");
+  rho.ScatterMasterToGhosted("cell");
+  const Epetra_MultiVector& pres_c = *pres.ViewComponent("cell", true);
+  const Epetra_MultiVector& rho_c = *rho.ViewComponent("cell", true);
+  Epetra_MultiVector& flux_dir_f = *flux_dir.ViewComponent("face", false);
+
+  auto& markers = bc_markers();
+  auto& values = bc_values();
+
+  for (int f = 0; f != flux_dir_faces_.size(); ++f) {
+    const FluxDirFace& face = flux_dir_faces_[f];
+    double flux = 0.;
+    if (face.c1 >= 0) {
+      double rho_f = (rho_c[0][face.c0] + rho_c[0][face.c1]) / 2.;
+      flux = face.trans * (pres_c[0][face.c0] - pres_c[0][face.c1] - rho_f * face.gdx);
+    } else if (markers[f] == Operators::OPERATOR_BC_DIRICHLET) {
+      flux = face.trans * (pres_c[0][face.c0] - values[f] - rho_c[0][face.c0] * face.gdx);
+    } else if (markers[f] == Operators::OPERATOR_BC_NEUMANN) {
+      flux = values[f];
+    }
+    flux_dir_f[0][f] = face.dir * flux;
+  }
+}
+
+
 void
 Richards::UpdateVelocity_(const Tag& tag)
 {
@@ -28,6 +28,7 @@
 #include "OperatorDefs.hh"
 #include "BoundaryFlux.hh"
 #include "pk_helpers.hh"
+#include "reductions.hh"
 
 #include "richards.hh"
 
@@ -53,6 +54,8 @@ Richards::Richards(Teuchos::ParameterList& pk_tree,
     modify_predictor_first_bc_flux_(false),
     upwind_from_prev_flux_(false),
     clobber_boundary_flux_dir_(false),
+    estimate_flux_dir_(false),
+    check_flux_dir_estimate_(false),
     vapor_diffusion_(false),
     perm_scale_(1.),
     jacobian_(false),
@@ -210,6 +213,17 @@ Richards::SetupRichardsFlow_()
     upwinding_ =
       Teuchos::rcp(new Operators::UpwindTotalFlux(name_, tag_next_, flux_dir_key_, flux_eps));
     Krel_method_ = Operators::UPWIND_METHOD_TOTAL_FLUX;
+
+    std::string dir_method = plist_->get<std::string>("flux direction method", "operator");
+    if (dir_method == "two-point estimate") {
+      estimate_flux_dir_ = true;
+    } else if (dir_method != "operator") {
+      Errors::Message message;
+      message << name_ << ": invalid \"flux direction method\" \"" << dir_method
+              << "\", valid are \"operator\" and \"two-point estimate\"";
+      Exceptions::amanzi_throw(message);
+    }
+    check_flux_dir_estimate_ = plist_->get<bool>("check flux direction estimate", false);
   } else if (method_name == "arithmetic mean") {
     upwinding_ = Teuchos::rcp(new Operators::UpwindArithmeticMean(name_, tag_next_));
     Krel_method_ = Operators::UPWIND_METHOD_ARITHMETIC_MEAN;
@@ -806,13 +820,36 @@ Richards::UpdatePermeabilityData_(const Tag& tag)
         S_->GetPtrW<CompositeVector>(flux_dir_key_, tag, name_);
       Teuchos::RCP<const CompositeVector> pres = S_->GetPtr<CompositeVector>(key_, tag);
 
-      if (!deform_key_.empty() &&
-          S_->GetEvaluator(deform_key_, tag_next_).Update(*S_, name_ + " flux dir"))
-        face_matrix_diff_->SetTensorCoefficient(K_);
-      face_matrix_diff_->SetDensity(rho);
-      face_matrix_diff_->UpdateMatrices(Teuchos::null, pres.ptr());
-      face_matrix_diff_->ApplyBCs(true, true, true);
-      face_matrix_diff_->UpdateFlux(pres.ptr(), flux_dir.ptr());
+      bool deformed = !deform_key_.empty() &&
+                      S_->GetEvaluator(deform_key_, tag_next_).Update(*S_, name_ + " flux dir");
+      if (deformed) flux_dir_faces_.clear();
+
+      if (estimate_flux_dir_ && !check_flux_dir_estimate_) {
+        EstimateFluxDirection_(tag, *flux_dir);
+      } else {
+        if (deformed) face_matrix_diff_->SetTensorCoefficient(K_);
+        face_matrix_diff_->SetDensity(rho);
+        face_matrix_diff_->UpdateMatrices(Teuchos::null, pres.ptr());
+        face_matrix_diff_->ApplyBCs(true, true, true);
+        face_matrix_diff_->UpdateFlux(pres.ptr(), flux_dir.ptr());
+
+        if (check_flux_dir_estimate_) {
+          CompositeVector estimate(*flux_dir);
+          EstimateFluxDirection_(tag, estimate);
+
+          const Epetra_MultiVector& exact_f = *flux_dir->ViewComponent("face", false);
+          const Epetra_MultiVector& estimate_f = *estimate.ViewComponent("face", false);
+          int counts_local[2] = { 0, exact_f.MyLength() };
+          for (int f = 0; f != exact_f.MyLength(); ++f) {
+            if (exact_f[0][f] * estimate_f[0][f] < 0.) counts_local[0]++;
+          }
+          int counts[2];
+          mesh_->getComm()->SumAll(counts_local, counts, 2);
+          if (vo_->os_OK(Teuchos::VERB_MEDIUM))
+            *vo_->os() << "  flux direction estimate differs on " << counts[0] << " of "
+                       << counts[1] << " faces" << std::endl;
+        }
+      }
 
       if (clobber_boundary_flux_dir_) {
         Epetra_MultiVector& flux_dir_f = *flux_dir->ViewComponent("face", false);
@@ -944,6 +981,7 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
 
   auto& markers = bc_markers();
   auto& values = bc_values();
+  const auto& face_cells = FaceCells_();
 
   // initialize all to 0
   for (unsigned int n = 0; n != markers.size(); ++n) {
@@ -962,10 +1000,7 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
   bc_names.push_back(key_);
   for (const auto& bc : *bc_pressure_) {
     int f = bc.first;
-#ifdef ENABLE_DBC
-    auto cells = mesh_->getFaceCells(f);
-    AMANZI_ASSERT(cells.size() == 1);
-#endif
+    AMANZI_ASSERT(face_cells[2 * f] == face_cells[2 * f + 1]);
     markers[f] = Operators::OPERATOR_BC_DIRICHLET;
     values[f] = bc.second;
   }
@@ -988,11 +1023,11 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
       // we need to find the elevation of the surface, but finding the top edge
       // of this stack of faces is not possible currently.  The best approach
       // is instead to work with the cell.
-      auto cells = mesh_->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
+      AmanziMesh::Entity_ID c = face_cells[2 * f];
+      AMANZI_ASSERT(c == face_cells[2 * f + 1]);
 
       markers[f] = Operators::OPERATOR_BC_DIRICHLET;
-      values[f] = p_atm + bc_rho_water_ * g * (bc.second + depth_c[0][cells[0]]);
+      values[f] = p_atm + bc_rho_water_ * g * (bc.second + depth_c[0][c]);
     }
   }
 
@@ -1024,10 +1059,7 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
   if (!infiltrate_only_if_unfrozen_) {
     for (const auto& bc : *bc_flux_) {
       int f = bc.first;
-#ifdef ENABLE_DBC
-      auto cells = mesh_->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
-#endif
+      AMANZI_ASSERT(face_cells[2 * f] == face_cells[2 * f + 1]);
       markers[f] = Operators::OPERATOR_BC_NEUMANN;
       values[f] = bc.second;
       if (!kr && rel_perm[0][f] > 0.) values[f] /= rel_perm[0][f];
@@ -1040,10 +1072,7 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
          ->ViewComponent("face");
     for (const auto& bc : *bc_flux_) {
       int f = bc.first;
-#ifdef ENABLE_DBC
-      auto cells = mesh_->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
-#endif
+      AMANZI_ASSERT(face_cells[2 * f] == face_cells[2 * f + 1]);
       markers[f] = Operators::OPERATOR_BC_NEUMANN;
       if (temp[0][f] > 273.15) {
         values[f] = bc.second;
@@ -1067,10 +1096,7 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
   bc_names.push_back("standard seepage");
   for (const auto& bc : *bc_seepage_) {
     int f = bc.first;
-#ifdef ENABLE_DBC
-    auto cells = mesh_->getFaceCells(f);
-    AMANZI_ASSERT(cells.size() == 1);
-#endif
+    AMANZI_ASSERT(face_cells[2 * f] == face_cells[2 * f + 1]);
 
     //double boundary_pressure = std::max(getFaceOnBoundaryValue(f, *u, *bc_), 101325.); // does not make sense to seep from nonsaturated cells
     double boundary_pressure =
@@ -1108,10 +1134,7 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
     int i = 0;
     for (const auto& bc : *bc_seepage_infilt_) {
       int f = bc.first;
-#ifdef ENABLE_DBC
-      auto cells = mesh_->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
-#endif
+      AMANZI_ASSERT(face_cells[2 * f] == face_cells[2 * f + 1]);
 
       double flux_seepage_tol = std::abs(bc.second) * .001;
       double boundary_pressure = getFaceOnBoundaryValue(f, *u, *bc_);
@@ -1182,10 +1205,7 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
     for (unsigned int c = 0; c != ncells_surface; ++c) {
       // -- get the surface cell's equivalent subsurface face
       AmanziMesh::Entity_ID f = surface->getEntityParent(AmanziMesh::Entity_kind::CELL, c);
-#ifdef ENABLE_DBC
-      auto cells = mesh_->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
-#endif
+      AMANZI_ASSERT(face_cells[2 * f] == face_cells[2 * f + 1]);
       // -- set that value to dirichlet
       markers[f] = Operators::OPERATOR_BC_DIRICHLET;
       values[f] = head[0][c];
@@ -1205,10 +1225,7 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
     for (unsigned int c = 0; c != ncells_surface; ++c) {
       // -- get the surface cell's equivalent subsurface face
       AmanziMesh::Entity_ID f = surface->getEntityParent(AmanziMesh::Entity_kind::CELL, c);
-#ifdef ENABLE_DBC
-      auto cells = mesh_->getFaceCells(f);
-      AMANZI_ASSERT(cells.size() == 1);
-#endif
+      AMANZI_ASSERT(face_cells[2 * f] == face_cells[2 * f + 1]);
       // -- set that value to Neumann
       markers[f] = Operators::OPERATOR_BC_NEUMANN;
 
@@ -1224,18 +1241,11 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
 
   // mark all remaining boundary conditions as zero flux conditions
   int n_default = 0;
-  int nfaces_owned =
-    mesh_->getNumEntities(AmanziMesh::Entity_kind::FACE, AmanziMesh::Parallel_kind::OWNED);
-  for (int f = 0; f < nfaces_owned; f++) {
+  for (auto f : BoundaryFaces_()) {
     if (markers[f] == Operators::OPERATOR_BC_NONE) {
-      auto cells = mesh_->getFaceCells(f);
-      int ncells = cells.size();
-
-      if (ncells == 1) {
-        n_default++;
-        markers[f] = Operators::OPERATOR_BC_NEUMANN;
-        values[f] = 0.0;
-      }
+      n_default++;
+      markers[f] = Operators::OPERATOR_BC_NEUMANN;
+      values[f] = 0.0;
     }
   }
   bc_names.push_back("default (zero flux)");
@@ -1479,10 +1489,12 @@ Richards::IsAdmissible(Teuchos::RCP<const TreeVector> up)
     maxT = maxT_c;
   }
 
-  double minT_l = minT;
-  double maxT_l = maxT;
-  mesh_->getComm()->MaxAll(&maxT_l, &maxT, 1);
-  mesh_->getComm()->MinAll(&minT_l, &minT, 1);
+  Reductions reductions(mesh_->getComm());
+  int min_handle = reductions.Min(minT);
+  int max_handle = reductions.Max(maxT);
+  reductions.Reduce();
+  minT = reductions[min_handle];
+  maxT = reductions[max_handle];
 
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
     *vo_->os() << "    Admissible p? (min/max): " << minT << ",  " << maxT << std::endl;
@@ -1549,13 +1561,13 @@ Richards::ModifyCorrection(double h,
   }
 
   // debugging -- remove me! --etc
-  for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
-       ++comp) {
-    Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
-    double max, l2;
-    du_c.NormInf(&max);
-    du_c.Norm2(&l2);
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
+         ++comp) {
+      Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
+      double max, l2;
+      du_c.NormInf(&max);
+      du_c.Norm2(&l2);
       *vo_->os() << "Linf, L2 pressure correction (" << *comp << ") = " << max << ", " << l2
                  << std::endl;
     }
@@ -1563,8 +1575,7 @@ Richards::ModifyCorrection(double h,
 
   // limit by capping corrections when they cross atmospheric pressure
   // (where pressure derivatives are discontinuous)
-  int my_limited = 0;
-  int n_limited_spurt = 0;
+  int my_limited_spurt = 0;
   if (patm_limit_ > 0.) {
     double patm = S_->Get<double>("atmospheric_pressure", Tags::DEFAULT);
     for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
@@ -1575,71 +1586,78 @@ Richards::ModifyCorrection(double h,
       for (int c = 0; c != du_c.MyLength(); ++c) {
         if ((u_c[0][c] < patm) && (u_c[0][c] - du_c[0][c] > patm + patm_limit_)) {
           du_c[0][c] = u_c[0][c] - (patm + patm_limit_);
-          my_limited++;
+          my_limited_spurt++;
         } else if ((u_c[0][c] > patm) && (u_c[0][c] - du_c[0][c] < patm - patm_limit_)) {
           du_c[0][c] = u_c[0][c] - (patm - patm_limit_);
-          my_limited++;
+          my_limited_spurt++;
         }
       }
     }
-    mesh_->getComm()->MaxAll(&my_limited, &n_limited_spurt, 1);
-  }
-
-  if (n_limited_spurt > 0) {
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) { *vo_->os() << "  limiting the spurt." << std::endl; }
   }
 
   // debugging -- remove me! --etc
-  for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
-       ++comp) {
-    Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
-    double max, l2;
-    du_c.NormInf(&max);
-    du_c.Norm2(&l2);
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
+         ++comp) {
+      Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
+      double max, l2;
+      du_c.NormInf(&max);
+      du_c.Norm2(&l2);
       *vo_->os() << "Linf, L2 pressure correction (" << *comp << ") = " << max << ", " << l2
                  << std::endl;
     }
   }
 
   // Limit based on a max pressure change
-  my_limited = 0;
-  int n_limited_change = 0;
+  int my_limited_change = 0;
   if (p_limit_ >= 0.) {
     for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
          ++comp) {
       Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
 
-      double max;
-      du_c.NormInf(&max);
       if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+        double max;
+        du_c.NormInf(&max);
         *vo_->os() << "Max pressure correction (" << *comp << ") = " << max << std::endl;
       }
 
       for (int c = 0; c != du_c.MyLength(); ++c) {
         if (std::abs(du_c[0][c]) > p_limit_) {
           du_c[0][c] = ((du_c[0][c] > 0) - (du_c[0][c] < 0)) * p_limit_;
-          my_limited++;
+          my_limited_change++;
         }
       }
     }
-
-    mesh_->getComm()->MaxAll(&my_limited, &n_limited_change, 1);
   }
 
   // debugging -- remove me! --etc
-  for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
-       ++comp) {
-    Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
-    double max, l2;
-    du_c.NormInf(&max);
-    du_c.Norm2(&l2);
-    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    for (CompositeVector::name_iterator comp = du->Data()->begin(); comp != du->Data()->end();
+         ++comp) {
+      Epetra_MultiVector& du_c = *du->Data()->ViewComponent(*comp, false);
+      double max, l2;
+      du_c.NormInf(&max);
+      du_c.Norm2(&l2);
       *vo_->os() << "Linf, L2 pressure correction (" << *comp << ") = " << max << ", " << l2
                  << std::endl;
     }
   }
 
+  // both limiters are reduced together
+  int n_limited_spurt = 0;
+  int n_limited_change = 0;
+  if (patm_limit_ > 0. || p_limit_ >= 0.) {
+    Reductions reductions(mesh_->getComm());
+    int spurt_handle = reductions.Max(my_limited_spurt);
+    int change_handle = reductions.Max(my_limited_change);
+    reductions.Reduce();
+    n_limited_spurt = reductions[spurt_handle];
+    n_limited_change = reductions[change_handle];
+  }
+
+  if (n_limited_spurt > 0) {
+    if (vo_->os_OK(Teuchos::VERB_HIGH)) { *vo_->os() << "  limiting the spurt." << std::endl; }
+  }
   if (n_limited_change > 0) {
     if (vo_->os_OK(Teuchos::VERB_HIGH)) { *vo_->os() << "  limited by pressure." << std::endl; }
   }
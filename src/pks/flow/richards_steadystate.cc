@@ -13,6 +13,7 @@ Steady state solution of Richards equation
 */
 
 #include "richards_steadystate.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -36,6 +37,7 @@ RichardsSteadyState::FunctionalResidual(double t_old,
                                         Teuchos::RCP<TreeVector> u_new,
                                         Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
 
@@ -126,6 +128,7 @@ RichardsSteadyState::FunctionalResidual(double t_old,
 void
 RichardsSteadyState::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) { *vo_->os() << "Precon update at t = " << t << std::endl; }
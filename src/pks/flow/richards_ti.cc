@@ -9,6 +9,7 @@
 
 #include "Op.hh"
 #include "richards.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -24,6 +25,7 @@ Richards::FunctionalResidual(double t_old,
                              Teuchos::RCP<TreeVector> u_new,
                              Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
 
@@ -112,6 +114,7 @@ Richards::FunctionalResidual(double t_old,
 int
 Richards::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon application:" << std::endl;
 
@@ -130,6 +133,7 @@ Richards::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<Tre
 void
 Richards::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
@@ -9,6 +9,7 @@
 
 #include "Op.hh"
 #include "snow_distribution.hh"
+#include "ProfileTimer.hh"
 
 #define DEBUG_FLAG 1
 
@@ -26,6 +27,7 @@ SnowDistribution::FunctionalResidual(double t_old,
                                      Teuchos::RCP<TreeVector> u_new,
                                      Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
 
@@ -111,6 +113,7 @@ SnowDistribution::FunctionalResidual(double t_old,
 int
 SnowDistribution::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon application:" << std::endl;
 
@@ -137,6 +140,7 @@ SnowDistribution::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos:
 void
 SnowDistribution::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon update at t = " << t << std::endl;
@@ -0,0 +1,90 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Dual numbers, and the three phase water content model evaluated on them,
+  whose partial derivatives must match the sympy-generated methods.
+*/
+
+#include <cmath>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "Dual.hh"
+#include "three_phase_water_content_model.hh"
+
+using namespace Amanzi;
+using namespace Amanzi::Flow::Relations;
+
+
+TEST(DUAL_POW_CONSTANT_EXPONENT)
+{
+  // a constant exponent works for a non-positive base, as for doubles
+  Dual<2> x = Dual<2>::Variable(-2., 0);
+  Dual<2> r = pow(x, Dual<2>(3.));
+  CHECK_CLOSE(-8., r.value(), 1.e-12);
+  CHECK_CLOSE(12., r.d(0), 1.e-12);
+  CHECK_EQUAL(0., r.d(1));
+
+  r = pow(Dual<2>::Variable(0., 0), Dual<2>(2.));
+  CHECK_EQUAL(0., r.value());
+  CHECK_EQUAL(0., r.d(0));
+}
+
+
+TEST(DUAL_POW_VARIABLE_EXPONENT)
+{
+  Dual<2> a = Dual<2>::Variable(1.5, 0);
+  Dual<2> b = Dual<2>::Variable(0.7, 1);
+  Dual<2> r = pow(a, b);
+  CHECK_CLOSE(std::pow(1.5, 0.7), r.value(), 1.e-12);
+  CHECK_CLOSE(0.7 * std::pow(1.5, -0.3), r.d(0), 1.e-12);
+  CHECK_CLOSE(std::pow(1.5, 0.7) * std::log(1.5), r.d(1), 1.e-12);
+}
+
+
+TEST(THREE_PHASE_WATER_CONTENT_DUAL_MATCHES_SYMPY)
+{
+  Teuchos::ParameterList plist;
+  ThreePhaseWaterContentModel model(plist);
+
+  using Deriv = double (ThreePhaseWaterContentModel::*)(
+    double, double, double, double, double, double, double, double, double) const;
+  const Deriv derivs[9] = { &ThreePhaseWaterContentModel::DWaterContentDPorosity,
+                            &ThreePhaseWaterContentModel::DWaterContentDSaturationLiquid,
+                            &ThreePhaseWaterContentModel::DWaterContentDMolarDensityLiquid,
+                            &ThreePhaseWaterContentModel::DWaterContentDSaturationIce,
+                            &ThreePhaseWaterContentModel::DWaterContentDMolarDensityIce,
+                            &ThreePhaseWaterContentModel::DWaterContentDSaturationGas,
+                            &ThreePhaseWaterContentModel::DWaterContentDMolarDensityGas,
+                            &ThreePhaseWaterContentModel::DWaterContentDMolFracGas,
+                            &ThreePhaseWaterContentModel::DWaterContentDCellVolume };
+
+  for (int k = 0; k != 5; ++k) {
+    double x[9] = { 0.2 + 0.1 * k,  0.5 - 0.1 * k, 55000., 0.1 * k, 50000.,
+                    0.5,            40. + k,       0.01 * k,        2.5 };
+    Dual<9> r = model.WaterContent(Dual<9>::Variable(x[0], 0),
+                                   Dual<9>::Variable(x[1], 1),
+                                   Dual<9>::Variable(x[2], 2),
+                                   Dual<9>::Variable(x[3], 3),
+                                   Dual<9>::Variable(x[4], 4),
+                                   Dual<9>::Variable(x[5], 5),
+                                   Dual<9>::Variable(x[6], 6),
+                                   Dual<9>::Variable(x[7], 7),
+                                   Dual<9>::Variable(x[8], 8));
+
+    double value = model.WaterContent(x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8]);
+    CHECK_CLOSE(value, r.value(), 1.e-12 * std::abs(value));
+    for (int i = 0; i != 9; ++i) {
+      double d = (model.*derivs[i])(x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7], x[8]);
+      CHECK_CLOSE(d, r.d(i), 1.e-12 * std::abs(d) + 1.e-12);
+    }
+  }
+}
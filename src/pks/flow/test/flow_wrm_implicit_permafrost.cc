@@ -0,0 +1,56 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include <iostream>
+#include "UnitTest++.h"
+
+#include "wrm_van_genuchten.hh"
+#include "wrm_implicit_permafrost_model.hh"
+
+
+TEST(implicitPermafrost_table)
+{
+  using namespace Amanzi::Flow;
+
+  Teuchos::ParameterList plist;
+  plist.set<double>("van Genuchten alpha [Pa^-1]", 1.5e-4);
+  plist.set<double>("van Genuchten m [-]", 0.8);
+  plist.set<double>("residual saturation [-]", 0.);
+  plist.set<double>("smoothing interval width [saturation]", 0.);
+  Teuchos::RCP<WRMVanGenuchten> wrm = Teuchos::rcp(new WRMVanGenuchten(plist));
+
+  Teuchos::ParameterList root_plist;
+  WRMImplicitPermafrostModel root(root_plist);
+  root.set_WRM(wrm);
+
+  double tol = 1.e-7;
+  Teuchos::ParameterList table_plist;
+  table_plist.set<bool>("use lookup table", true);
+  table_plist.set<double>("table error tolerance [-]", tol);
+  WRMImplicitPermafrostModel table(table_plist);
+  table.set_WRM(wrm);
+
+  // frozen, unsaturated states, plus a few out of the table
+  for (int i = 0; i != 40; ++i) {
+    double pc_liq = std::pow(10., -1. + 9. * i / 40);
+    for (int j = 0; j != 40; ++j) {
+      double pc_ice = std::pow(10., 3. * (j + 0.5) / 40 + 4.);
+      double sats[3], sats_table[3], dsats[3], dsats_table[3];
+
+      root.saturations(pc_liq, pc_ice, sats);
+      table.saturations(pc_liq, pc_ice, sats_table);
+      for (int k = 0; k != 3; ++k) CHECK_CLOSE(sats[k], sats_table[k], 10 * tol);
+
+      root.dsaturations_dpc_liq(pc_liq, pc_ice, dsats);
+      table.dsaturations_dpc_liq(pc_liq, pc_ice, dsats_table);
+      CHECK_CLOSE(dsats[2], dsats_table[2], 1.e-2 * std::abs(dsats[2]) + 1.e-12);
+    }
+  }
+}
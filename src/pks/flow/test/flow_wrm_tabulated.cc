@@ -0,0 +1,146 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "wrm_van_genuchten.hh"
+#include "wrm_tabulated.hh"
+
+using namespace Amanzi::Flow;
+
+namespace {
+
+Teuchos::ParameterList
+tabulatedVanGenuchtenList(double tol)
+{
+  Teuchos::ParameterList plist("tabulated van Genuchten");
+  plist.set<std::string>("wrm type", "tabulated");
+  plist.set<double>("table error tolerance [-]", tol);
+  Teuchos::ParameterList& vg_list = plist.sublist("WRM parameters");
+  vg_list.set<std::string>("wrm type", "van Genuchten");
+  vg_list.set<double>("van Genuchten alpha [Pa^-1]", 2.e-4);
+  vg_list.set<double>("van Genuchten m [-]", 0.3);
+  vg_list.set<double>("residual saturation [-]", 0.1);
+  vg_list.set<double>("smoothing interval width [saturation]", 0.05);
+  return plist;
+}
+
+// evaluations per second of fn over n pressures spread across the curve
+template <class Fn>
+double
+evalsPerSecond(Fn fn, int n, double& sum)
+{
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i != n; ++i) sum += fn(std::pow(10., -2. + 9. * i / n));
+  auto t1 = std::chrono::steady_clock::now();
+  return n / std::chrono::duration<double>(t1 - t0).count();
+}
+
+} // namespace
+
+
+TEST(tabulated_accuracy)
+{
+  double tol = 1.e-7;
+  Teuchos::ParameterList plist = tabulatedVanGenuchtenList(tol);
+  WRMTabulated tab(plist);
+  WRMVanGenuchten vG(plist.sublist("WRM parameters"));
+
+  for (int i = 0; i != 10000; ++i) {
+    double pc = std::pow(10., -3. + 11. * i / 10000);
+    CHECK_CLOSE(vG.saturation(pc), tab.saturation(pc), tol);
+
+    double s = 0.1 + 0.9 * i / 10000;
+    CHECK_CLOSE(vG.k_relative(s), tab.k_relative(s), tol);
+  }
+
+  // saturated and out-of-table values use the wrapped model
+  CHECK_EQUAL(vG.saturation(-1.), tab.saturation(-1.));
+  CHECK_EQUAL(vG.k_relative(1.), tab.k_relative(1.));
+  CHECK_EQUAL(vG.d_saturation(0.), tab.d_saturation(0.));
+
+  // derivatives are those of the table, so they are consistent with it
+  for (double pc : { 10., 1.e3, 1.e5 }) {
+    double dpc = 1.e-6 * pc;
+    double fd = (tab.saturation(pc + dpc) - tab.saturation(pc - dpc)) / (2 * dpc);
+    CHECK_CLOSE(fd, tab.d_saturation(pc), 1.e-4 * std::abs(fd) + 1.e-14);
+  }
+
+  // monotone
+  double s_prev = 1.;
+  for (int i = 0; i != 10000; ++i) {
+    double s = tab.saturation(std::pow(10., -3. + 11. * i / 10000));
+    CHECK(s <= s_prev);
+    s_prev = s;
+  }
+}
+
+
+TEST(tabulated_benchmark)
+{
+  Teuchos::ParameterList plist = tabulatedVanGenuchtenList(1.e-7);
+  WRMTabulated tab(plist);
+  WRMVanGenuchten vG(plist.sublist("WRM parameters"));
+
+  // call through the base class, as WRMEvaluator does
+  WRM& analytic = vG;
+  WRM& tabulated = tab;
+
+  int n = 2000000;
+  double sum = 0.;
+  std::cout << "WRM evaluations per second: analytic / tabulated" << std::endl;
+
+  double a = evalsPerSecond([&](double pc) { return analytic.saturation(pc); }, n, sum);
+  double t = evalsPerSecond([&](double pc) { return tabulated.saturation(pc); }, n, sum);
+  std::cout << "  saturation:     " << a << " / " << t << std::endl;
+
+  a = evalsPerSecond([&](double pc) { return analytic.d_saturation(pc); }, n, sum);
+  t = evalsPerSecond([&](double pc) { return tabulated.d_saturation(pc); }, n, sum);
+  std::cout << "  d_saturation:   " << a << " / " << t << std::endl;
+
+  auto sat = [](double pc) { return 0.1 + 0.9 / (1. + 1.e-4 * pc); };
+  a = evalsPerSecond([&](double pc) { return analytic.k_relative(sat(pc)); }, n, sum);
+  t = evalsPerSecond([&](double pc) { return tabulated.k_relative(sat(pc)); }, n, sum);
+  std::cout << "  k_relative:     " << a << " / " << t << std::endl;
+
+  a = evalsPerSecond([&](double pc) { return analytic.d_k_relative(sat(pc)); }, n, sum);
+  t = evalsPerSecond([&](double pc) { return tabulated.d_k_relative(sat(pc)); }, n, sum);
+  std::cout << "  d_k_relative:   " << a << " / " << t << std::endl;
+
+  CHECK(std::isfinite(sum));
+}
+
+
+TEST(batched_evaluation)
+{
+  Teuchos::ParameterList plist = tabulatedVanGenuchtenList(1.e-7);
+  WRMTabulated tab(plist);
+  WRMVanGenuchten vG(plist.sublist("WRM parameters"));
+
+  // every other entry, as a region of a partitioned mesh would be
+  int n = 1000;
+  std::vector<double> pc(2 * n), sat(2 * n, -1.), dkr(2 * n);
+  std::vector<int> idx(n);
+  for (int i = 0; i != 2 * n; ++i) pc[i] = std::pow(10., -2. + 9. * i / (2 * n));
+  for (int k = 0; k != n; ++k) idx[k] = 2 * k + 1;
+
+  for (WRM* wrm : std::vector<WRM*>{ &vG, &tab }) {
+    wrm->saturation_batch(n, idx.data(), pc.data(), sat.data());
+    for (int i = 0; i != 2 * n; ++i) {
+      CHECK_EQUAL(i % 2 ? wrm->saturation(pc[i]) : -1., sat[i]);
+    }
+
+    wrm->d_k_relative_batch(n, idx.data(), sat.data(), dkr.data());
+    for (int k = 0; k != n; ++k) CHECK_EQUAL(wrm->d_k_relative(sat[idx[k]]), dkr[idx[k]]);
+  }
+}
@@ -22,12 +22,67 @@ calculations by a standard MPC.
 #ifndef AMANZI_EWC_MODEL_HH_
 #define AMANZI_EWC_MODEL_HH_
 
+#include <vector>
+
 #include "State.hh"
 
 namespace Amanzi {
 
 class State;
 
+//
+// Structure-of-arrays workspace for inverting energy and water content of
+// many cells at once.  Targets are per unit volume, as in InverseEvaluate(),
+// and T, p hold the initial guess on input and the solution on output.
+//
+struct EWCInverseBatch {
+  int size() const { return cells.size(); }
+
+  void clear()
+  {
+    cells.clear();
+    energy.clear();
+    wc.clear();
+    T.clear();
+    p.clear();
+    ierr.clear();
+    iterations.clear();
+  }
+
+  void push_back(int c, double energy_c, double wc_c, double T_c, double p_c)
+  {
+    cells.push_back(c);
+    energy.push_back(energy_c);
+    wc.push_back(wc_c);
+    T.push_back(T_c);
+    p.push_back(p_c);
+    ierr.push_back(0);
+    iterations.push_back(0);
+  }
+
+  // Adds the number of cells that converged in each number of iterations to
+  // hist, which is grown as needed.  Returns the number of failed cells.
+  int Histogram(std::vector<int>& hist) const
+  {
+    int nfailed = 0;
+    for (int i = 0; i != size(); ++i) {
+      if (ierr[i]) {
+        nfailed++;
+      } else {
+        if (iterations[i] >= hist.size()) hist.resize(iterations[i] + 1, 0);
+        hist[iterations[i]]++;
+      }
+    }
+    return nfailed;
+  }
+
+  std::vector<int> cells;
+  std::vector<double> energy, wc;
+  std::vector<double> T, p;
+  std::vector<int> ierr;       // error code of InverseEvaluate(), 0 on success
+  std::vector<int> iterations; // Newton iterations taken
+};
+
 class EWCModel {
  public:
   virtual ~EWCModel() = default;
@@ -41,6 +96,10 @@ class EWCModel {
   InverseEvaluate(double energy, double wc, double& T, double& p, bool verbose = false) = 0;
   virtual int InverseEvaluateEnergy(double energy, double p, double& T) = 0;
 
+  // Inverts all cells of the batch, calling UpdateModel() as needed.  Errors
+  // are returned per cell in batch.ierr, nothing is written to screen.
+  virtual void InverseEvaluateBatch(const Teuchos::Ptr<State>& S, EWCInverseBatch& batch) = 0;
+
   virtual int
   EvaluateSaturations(double T, double p, double& s_gas, double& s_liq, double& s_ice) = 0;
 };
@@ -15,6 +15,10 @@ evaluating.
 
 ------------------------------------------------------------------------- */
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "ewc_model_base.hh"
 
 #define DEBUG_FLAG 0
@@ -205,6 +209,149 @@ EWCModelBase::InverseEvaluate(double energy, double wc, double& T, double& p, bo
 }
 
 
+/* ----------------------------------------------------------------------
+Batched version of InverseEvaluate().
+
+All cells of the batch take their Newton iterations in lock-step: each
+stage of the iteration (correction, full step, backtracking, Jacobian
+update) is done for every cell still iterating before moving on to the
+next stage, with the per-cell iterate, residual and Jacobian stored as
+separate arrays.  Converged and failed cells are dropped from the list of
+active cells, so the cost of an iteration is proportional to the number
+of cells still iterating.
+
+Each cell follows exactly the same steps as it would in InverseEvaluate(),
+and gets the same error codes, stored in batch.ierr.  On error, T and p of
+that cell are left at the initial guess.  On return the model is updated to
+an unspecified cell of the batch.
+---------------------------------------------------------------------- */
+void
+EWCModelBase::InverseEvaluateBatch(const Teuchos::Ptr<State>& S, EWCInverseBatch& batch)
+{
+  const double T_corr_cap = 2.;
+  const double p_corr_cap = 200000.;
+  const double tol = 1.e-6;
+  const int max_steps = 100;
+
+  int n = batch.size();
+  if (n == 0) return;
+  UpdateModelBatch_(S, n, batch.cells.data());
+
+  // workspace: iterate x, residual r, Jacobian J, capped correction dx
+  std::vector<double> x0(batch.T), x1(batch.p);
+  std::vector<double> r0(n), r1(n), J00(n), J01(n), J10(n), J11(n);
+  std::vector<double> dx0(n), dx1(n), damp(n), norm(n), norm_new(n);
+
+  // evaluates lane i at T,p, storing the residual (and Jacobian)
+  AmanziGeometry::Point res(2);
+  WhetStone::Tensor jac(2, 2);
+  auto evaluate = [&](int i, double T, double p, bool with_jac) {
+    SelectBatchLane_(i);
+    int ierr = with_jac ? EvaluateEnergyAndWaterContentAndJacobian_(T, p, res, jac) :
+                          EvaluateEnergyAndWaterContent_(T, p, res);
+    if (ierr) {
+      batch.ierr[i] = ierr + 10;
+      return false;
+    }
+    r0[i] = res[0] - batch.energy[i];
+    r1[i] = res[1] - batch.wc[i];
+    if (with_jac) {
+      J00[i] = jac(0, 0);
+      J01[i] = jac(0, 1);
+      J10[i] = jac(1, 0);
+      J11[i] = jac(1, 1);
+    }
+    return true;
+  };
+
+  // initial residual
+  std::vector<int> active, lanes, backtrack;
+  active.reserve(n);
+  lanes.reserve(n);
+  for (int i = 0; i != n; ++i) {
+    batch.ierr[i] = 0;
+    batch.iterations[i] = 0;
+    if (!evaluate(i, x0[i], x1[i], true)) continue;
+    norm[i] = std::sqrt(r0[i] * r0[i] + r1[i] * r1[i]);
+    if (!(norm[i] < tol)) active.push_back(i);
+  }
+
+  while (!active.empty()) {
+    // capped Newton correction
+    lanes.clear();
+    for (int i : active) {
+      double detJ = J00[i] * J11[i] - J01[i] * J10[i];
+      if (std::abs(detJ) < 1.e-20) {
+        batch.ierr[i] = 1;
+        continue;
+      }
+      double corr0 = (J11[i] / detJ) * r0[i] - (J01[i] / detJ) * r1[i];
+      double corr1 = (J00[i] / detJ) * r1[i] - (J10[i] / detJ) * r0[i];
+      double scale = std::min({ 1., T_corr_cap / std::abs(corr0), p_corr_cap / std::abs(corr1) });
+      dx0[i] = scale * corr0;
+      dx1[i] = scale * corr1;
+      damp[i] = 1.;
+      lanes.push_back(i);
+    }
+    active.swap(lanes);
+
+    // full step
+    lanes.clear();
+    for (int i : active) {
+      if (!evaluate(i, x0[i] - dx0[i], x1[i] - dx1[i], true)) continue;
+      norm_new[i] = std::sqrt(r0[i] * r0[i] + r1[i] * r1[i]);
+      lanes.push_back(i);
+    }
+    active.swap(lanes);
+
+    // backtrack cells whose residual increased until it no longer does
+    backtrack.clear();
+    for (int i : active) {
+      if (norm_new[i] > norm[i]) backtrack.push_back(i);
+    }
+    while (!backtrack.empty()) {
+      lanes.clear();
+      for (int i : backtrack) {
+        damp[i] *= 0.5;
+        if (!evaluate(i, x0[i] - damp[i] * dx0[i], x1[i] - damp[i] * dx1[i], false)) continue;
+        norm_new[i] = std::sqrt(r0[i] * r0[i] + r1[i] * r1[i]);
+        if (norm_new[i] > norm[i]) lanes.push_back(i);
+      }
+      backtrack.swap(lanes);
+    }
+
+    // accept the step, recalculating the Jacobian of backtracked cells
+    lanes.clear();
+    for (int i : active) {
+      if (batch.ierr[i]) continue;
+      double T_new = x0[i] - damp[i] * dx0[i];
+      double p_new = x1[i] - damp[i] * dx1[i];
+      if (damp[i] < 1. && !evaluate(i, T_new, p_new, true)) continue;
+      x0[i] = T_new;
+      x1[i] = p_new;
+      norm[i] = norm_new[i];
+      batch.iterations[i]++;
+
+      double dT = damp[i] * dx0[i];
+      double dp_scaled = damp[i] * dx1[i] / 100000.;
+      if (norm[i] < tol || std::sqrt(dT * dT + dp_scaled * dp_scaled) < 1.e-10) continue;
+      if (batch.iterations[i] > max_steps) {
+        batch.ierr[i] = 2;
+        continue;
+      }
+      lanes.push_back(i);
+    }
+    active.swap(lanes);
+  }
+
+  for (int i = 0; i != n; ++i) {
+    if (batch.ierr[i]) continue;
+    batch.T[i] = x0[i];
+    batch.p[i] = x1[i];
+  }
+}
+
+
 /* ----------------------------------------------------------------------
 Solves a given energy and water content (at a given, fixed porosity), for
 temperature and pressure.
@@ -346,6 +493,21 @@ EWCModelBase::InverseEvaluateEnergy(double energy, double p, double& T)
 }
 
 
+void
+EWCModelBase::UpdateModelBatch_(const Teuchos::Ptr<State>& S, int n, const int* cells)
+{
+  S_batch_ = S;
+  cells_batch_ = cells;
+}
+
+
+void
+EWCModelBase::SelectBatchLane_(int i)
+{
+  UpdateModel(S_batch_, cells_batch_[i]);
+}
+
+
 int
 EWCModelBase::EvaluateEnergyAndWaterContentAndJacobian_(double T,
                                                         double p,
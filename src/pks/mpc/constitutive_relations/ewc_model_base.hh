@@ -27,15 +27,22 @@ namespace Amanzi {
 
 class EWCModelBase : public EWCModel {
  public:
-  EWCModelBase() {}
+  EWCModelBase() : cells_batch_(nullptr) {}
   virtual ~EWCModelBase() = default;
 
   virtual int Evaluate(double T, double p, double& energy, double& wc) override;
   virtual int
   InverseEvaluate(double energy, double wc, double& T, double& p, bool verbose = false) override;
   virtual int InverseEvaluateEnergy(double energy, double p, double& T) override;
+  virtual void InverseEvaluateBatch(const Teuchos::Ptr<State>& S, EWCInverseBatch& batch) override;
 
  protected:
+  // Called once before inverting a batch, and then before every evaluation of
+  // lane i of that batch.  The defaults call UpdateModel() for the lane's
+  // cell; models may override these to gather cell data once per batch.
+  virtual void UpdateModelBatch_(const Teuchos::Ptr<State>& S, int n, const int* cells);
+  virtual void SelectBatchLane_(int i);
+
   virtual int EvaluateEnergyAndWaterContent_(double T, double p, AmanziGeometry::Point& result) = 0;
 
   int EvaluateEnergyAndWaterContentAndJacobian_(double T,
@@ -47,6 +54,10 @@ class EWCModelBase : public EWCModel {
                                                    double p,
                                                    AmanziGeometry::Point& result,
                                                    WhetStone::Tensor& jac);
+
+ private:
+  Teuchos::Ptr<State> S_batch_;
+  const int* cells_batch_;
 };
 
 } // namespace Amanzi
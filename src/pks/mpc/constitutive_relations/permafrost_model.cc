@@ -175,6 +175,31 @@ PermafrostModel::UpdateModel(const Teuchos::Ptr<State>& S, int c)
   AMANZI_ASSERT(IsSetUp_());
 }
 
+void
+PermafrostModel::UpdateModelBatch_(const Teuchos::Ptr<State>& S, int n, const int* cells)
+{
+  // look up cell data once, rather than in UpdateModel() for every evaluation
+  p_atm_ = S->Get<double>("atmospheric_pressure", Tags::DEFAULT);
+  batch_rho_rock_ = (*S->Get<CompositeVector>(Keys::getKey(domain, "density_rock"), tag_)
+                        .ViewComponent("cell"))[0];
+  batch_poro_ = (*S->Get<CompositeVector>(Keys::getKey(domain, "base_porosity"), tag_)
+                    .ViewComponent("cell"))[0];
+  batch_cells_ = cells;
+}
+
+void
+PermafrostModel::SelectBatchLane_(int i)
+{
+  int c = batch_cells_[i];
+  rho_rock_ = batch_rho_rock_[c];
+  poro_ = batch_poro_[c];
+  wrm_ = wrms_->second[(*wrms_->first)[c]];
+  if (!poro_leij_)
+    poro_model_ = poro_models_->second[(*poro_models_->first)[c]];
+  else
+    poro_leij_model_ = poro_leij_models_->second[(*poro_leij_models_->first)[c]];
+}
+
 bool
 PermafrostModel::IsSetUp_()
 {
@@ -62,6 +62,9 @@ class PermafrostModel : public EWCModelBase {
 
   int EvaluateEnergyAndWaterContent_(double T, double p, AmanziGeometry::Point& result) override;
 
+  virtual void UpdateModelBatch_(const Teuchos::Ptr<State>& S, int n, const int* cells) override;
+  virtual void SelectBatchLane_(int i) override;
+
  protected:
   Teuchos::RCP<Flow::WRMPermafrostModelPartition> wrms_;
   Teuchos::RCP<Flow::WRMPermafrostModel> wrm_;
@@ -85,6 +88,12 @@ class PermafrostModel : public EWCModelBase {
   double p_atm_;
   double poro_;
   double rho_rock_;
+
+  // cell data of the batch being inverted
+  const int* batch_cells_;
+  const double* batch_poro_;
+  const double* batch_rho_rock_;
+
   bool poro_leij_;
   Key domain;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
@@ -45,6 +45,7 @@
 #include "PDE_Accumulation.hh"
 
 #include "mpc_coupled_cells.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 
@@ -129,6 +130,7 @@ MPCCoupledCells::Setup()
 void
 MPCCoupledCells::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   StrongMPC<PK_PhysicalBDF_Default>::UpdatePreconditioner(t, up, h);
 
   if (dA_dy2_ != Teuchos::null &&
@@ -161,6 +163,7 @@ MPCCoupledCells::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> u
 int
 MPCCoupledCells::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   // write residuals
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
     *vo_->os() << "Residuals:" << std::endl;
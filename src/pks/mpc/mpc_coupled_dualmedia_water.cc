@@ -11,6 +11,7 @@
 #include "EpetraExt_RowMatrixOut.h"
 
 #include "mpc_coupled_dualmedia_water.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 
@@ -138,6 +139,7 @@ MPCCoupledDualMediaWater::FunctionalResidual(double t_old,
                                              Teuchos::RCP<TreeVector> u_new,
                                              Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
   // propagate updated info into state
   Solution_to_State(*u_new, S_next_);
 
@@ -161,6 +163,7 @@ int
 MPCCoupledDualMediaWater::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
                                               Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   int ierr;
 
   return (ierr > 0) ? 0 : 1;
@@ -172,6 +175,7 @@ MPCCoupledDualMediaWater::UpdatePreconditioner(double t,
                                                Teuchos::RCP<const TreeVector> up,
                                                double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
 }
@@ -14,6 +14,7 @@
 #include "pk_helpers.hh"
 #include "mpc_surface_subsurface_helpers.hh"
 #include "mpc_coupled_water.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 
@@ -149,6 +150,7 @@ MPCCoupledWater::FunctionalResidual(double t_old,
                                     Teuchos::RCP<TreeVector> u_new,
                                     Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
   // propagate updated info into state
   Solution_to_State(*u_new, tag_next_);
 
@@ -176,6 +178,7 @@ MPCCoupledWater::FunctionalResidual(double t_old,
 int
 MPCCoupledWater::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon application:" << std::endl;
 
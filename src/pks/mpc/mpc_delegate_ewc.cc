@@ -16,6 +16,7 @@ energy/water-content space instead of temperature/pressure space.
 #include "Evaluator.hh"
 #include "ewc_model.hh"
 #include "mpc_delegate_ewc.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 
@@ -28,8 +29,8 @@ MPCDelegateEWC::MPCDelegateEWC(Teuchos::ParameterList& plist, const Teuchos::RCP
   : plist_(Teuchos::rcpFromRef(plist)), S_(S)
 {
   // set up the VerboseObject
-  std::string name = plist_->get<std::string>("PK name") + std::string(" EWC");
-  vo_ = Teuchos::rcp(new VerboseObject(name, *plist_));
+  name_ = plist_->get<std::string>("PK name") + std::string(" EWC");
+  vo_ = Teuchos::rcp(new VerboseObject(name_, *plist_));
 }
 
 // -----------------------------------------------------------------------------
@@ -173,6 +174,7 @@ MPCDelegateEWC::commit_state()
 bool
 MPCDelegateEWC::ModifyPredictor(double h, Teuchos::RCP<TreeVector> up)
 {
+  Profiling::ScopedTimer timer("pk", name_, "ModifyPredictor");
   bool modified = false;
   double dt_prev = S_->get_time(tag_current_) - time_prev2_;
 
@@ -194,6 +196,7 @@ MPCDelegateEWC::ModifyPredictor(double h, Teuchos::RCP<TreeVector> up)
 void
 MPCDelegateEWC::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name_, "UpdatePreconditioner");
   if (precon_type_ == PRECON_EWC || precon_type_ == PRECON_SMART_EWC) {
     update_precon_ewc_(t, up, h);
   }
@@ -206,6 +209,7 @@ MPCDelegateEWC::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up
 int
 MPCDelegateEWC::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name_, "ApplyPreconditioner");
   int ierr = 0;
   if ((precon_type_ == PRECON_EWC) || (precon_type_ == PRECON_SMART_EWC)) {
     precon_ewc_(u, Pu);
@@ -249,4 +253,29 @@ MPCDelegateEWC::update_precon_ewc_(double t, Teuchos::RCP<const TreeVector> up,
   }
 }
 
+
+// -----------------------------------------------------------------------------
+// Summarize the inversions of batch_: number of cells, failures, and how many
+// cells converged in each number of iterations.
+// -----------------------------------------------------------------------------
+void
+MPCDelegateEWC::ReportInverseBatch_(const std::string& name)
+{
+  if (!vo_->os_OK(Teuchos::VERB_HIGH)) return;
+
+  std::vector<int> hist;
+  int nfailed = batch_.Histogram(hist);
+
+  Teuchos::OSTab tab = vo_->getOSTab();
+  *vo_->os() << "  EWC " << name << ": inverted " << batch_.size() << " cells, " << nfailed
+             << " failed" << std::endl;
+  if (!hist.empty()) {
+    *vo_->os() << "    iterations (cells):";
+    for (int k = 0; k != hist.size(); ++k) {
+      if (hist[k]) *vo_->os() << " " << k << " (" << hist[k] << ")";
+    }
+    *vo_->os() << std::endl;
+  }
+}
+
 } // namespace Amanzi
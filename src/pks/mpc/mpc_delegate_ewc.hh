@@ -88,9 +88,9 @@ provides the initial guess to the nonlinear solve.
 #include "State.hh"
 #include "TreeVector.hh"
 
-namespace Amanzi {
+#include "ewc_model.hh"
 
-class EWCModel;
+namespace Amanzi {
 
 class MPCDelegateEWC {
  public:
@@ -113,8 +113,11 @@ class MPCDelegateEWC {
 
   virtual void update_precon_ewc_(double t, Teuchos::RCP<const TreeVector> up, double h);
 
+  // writes the iteration histogram of batch_ at high verbosity
+  void ReportInverseBatch_(const std::string& name);
 
  protected:
+  std::string name_;
   Teuchos::RCP<Teuchos::ParameterList> plist_;
   Teuchos::RCP<VerboseObject> vo_;
   Teuchos::RCP<Debugger> db_;
@@ -135,10 +138,22 @@ class MPCDelegateEWC {
     PRECON_SMART_EWC,
   };
 
+  // how the result of inverting a cell is used
+  enum EWCAcceptType {
+    EWC_ACCEPT_ALWAYS = 0,
+    EWC_ACCEPT_ADMISSIBLE,
+    EWC_ACCEPT_SMALLER_DT,
+    EWC_ACCEPT_SMALLER_DP
+  };
+
   // control flags
   PreconditionerType precon_type_;
   PredictorType predictor_type_;
 
+  // cells to be inverted together
+  EWCInverseBatch batch_;
+  std::vector<EWCAcceptType> batch_accept_;
+
   // extra data
   std::vector<WhetStone::Tensor> jac_;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
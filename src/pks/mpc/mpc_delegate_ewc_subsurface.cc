@@ -93,6 +93,11 @@ MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<Tre
   const Epetra_MultiVector& cv =
     *S_->GetPtr<CompositeVector>(cv_key_, tag_next_)->ViewComponent("cell", false);
 
+  // Decide which cells need EWC, and how the inversion is to be used.  All
+  // inversions are then done at once.
+  batch_.clear();
+  batch_accept_.clear();
+
   int rank = mesh_->getComm()->MyPID();
   int ncells = wc0.MyLength();
   for (int c = 0; c != ncells; ++c) {
@@ -100,7 +105,6 @@ MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<Tre
     if (vo_->os_OK(Teuchos::VERB_EXTREME)) dcvo = db_->GetVerboseObject(c, rank);
     Teuchos::OSTab dctab = dcvo == Teuchos::null ? vo_->getOSTab() : dcvo->getOSTab();
 
-    AmanziGeometry::Point result(2);
     int ierr = 0;
 
     double T_guess = temp_guess_c[0][c];
@@ -158,26 +162,9 @@ MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<Tre
 
       } else {
         // -- invert for T,p at the projected ewc
-        ierr = model_->InverseEvaluate(e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
+        batch_.push_back(c, e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
+        batch_accept_.push_back(EWC_ACCEPT_ADMISSIBLE);
         ewc_completed = true;
-        if (ierr) {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-            *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-          // pass, keep the T,p projections
-        } else {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-            *dcvo->os() << "     kept within the transition zone." << std::endl
-                        << "   p,T = " << p << ", " << T << std::endl;
-
-          // in the transition zone of latent heat exchange
-          if (T > 200.) {
-            temp_guess_c[0][c] = T;
-            pres_guess_c[0][c] = p;
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "       not admissible!" << std::endl;
-          }
-        }
       }
 #if EWC_THAWING
     } else { // increasing, thawing
@@ -195,31 +182,9 @@ MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<Tre
 
       } else {
         // in the transition zone of latent heat exchange
-        ierr = model_->InverseEvaluate(e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
+        batch_.push_back(c, e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
+        batch_accept_.push_back(EWC_ACCEPT_SMALLER_DT);
         ewc_completed = true;
-        if (ierr) {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-            *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-          // pass, keep the T,p projections
-        } else {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-            *dcvo->os() << "     kept within the transition zone." << std::endl
-                        << "   p,T = " << p << ", " << T << std::endl;
-
-          // two ways to get a projected T past freezing point:
-          //  -- be on the lower branch and overshoot (ewc results in smaller dT)
-          //  -- be on the middle branch and get over the hump (ewc results in much larger dT)
-          if (T - T_prev < temp_guess_c[0][c] - T_prev) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     dT_ewc < dT_std, on the lower branch, using EWC" << std::endl;
-            temp_guess_c[0][c] = T;
-            pres_guess_c[0][c] = p;
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     dT_ewc > dT_std, on the middle branch, use std prediction"
-                          << std::endl;
-          }
-        }
       }
 #endif
     }
@@ -244,25 +209,8 @@ MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<Tre
 
         } else {
           // -- invert for T,p at the projected ewc
-          ierr = model_->InverseEvaluate(e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
-          if (ierr) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-            // pass, keep the T,p projections
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     kept within the transition zone." << std::endl
-                          << "   p,T = " << p << ", " << T << std::endl;
-
-            // in the transition zone of latent heat exchange
-            if (T > 200.) {
-              temp_guess_c[0][c] = T;
-              pres_guess_c[0][c] = p;
-            } else {
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "       not admissible!" << std::endl;
-            }
-          }
+          batch_.push_back(c, e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
+          batch_accept_.push_back(EWC_ACCEPT_ADMISSIBLE);
         }
 
 #  if EWC_INCREASING_PRESSURE
@@ -281,36 +229,83 @@ MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<Tre
 
         } else {
           // in the transition zone of latent heat exchange
-          ierr = model_->InverseEvaluate(e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
-          if (ierr) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-            // pass, keep the T,p projections
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     kept within the transition zone." << std::endl
-                          << "   p,T = " << p << ", " << T << std::endl;
-
-            // two ways to get a projected p to saturated:
-            //  -- be on the lower branch and overshoot (ewc results in smaller dp)
-            //  -- be on the middle branch and get over the hump (ewc results in much larger dp)
-            if (p - p_prev < pres_guess_c[0][c] - p_prev) {
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "     dp_ewc < dp_std, on the lower branch, using EWC" << std::endl;
-              temp_guess_c[0][c] = T;
-              pres_guess_c[0][c] = p;
-            } else {
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "     dp_ewc > dp_std, on the middle branch, use std prediction"
-                            << std::endl;
-            }
-          }
+          batch_.push_back(c, e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
+          batch_accept_.push_back(EWC_ACCEPT_SMALLER_DP);
         }
 #  endif
       }
     }
 #endif
   }
+
+  // invert and use the results
+  model_->InverseEvaluateBatch(S_.ptr(), batch_);
+  ReportInverseBatch_("predictor");
+
+  for (int i = 0; i != batch_.size(); ++i) {
+    int c = batch_.cells[i];
+    Teuchos::RCP<VerboseObject> dcvo = Teuchos::null;
+    if (vo_->os_OK(Teuchos::VERB_EXTREME)) dcvo = db_->GetVerboseObject(c, rank);
+    Teuchos::OSTab dctab = dcvo == Teuchos::null ? vo_->getOSTab() : dcvo->getOSTab();
+    bool debug = dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME);
+
+    if (batch_.ierr[i]) {
+      if (debug)
+        *dcvo->os() << "FAILED EWC PREDICTOR: c = " << c << ", ierr = " << batch_.ierr[i]
+                    << std::endl;
+      continue; // keep the T,p projections
+    }
+
+    double T = batch_.T[i];
+    double p = batch_.p[i];
+    if (debug)
+      *dcvo->os() << std::setprecision(14) << "EWC predictor: c = " << c << std::endl
+                  << "     kept within the transition zone, " << batch_.iterations[i]
+                  << " iterations." << std::endl
+                  << "   p,T = " << p << ", " << T << std::endl;
+
+    if (batch_accept_[i] == EWC_ACCEPT_ADMISSIBLE) {
+      // in the transition zone of latent heat exchange
+      if (T > 200.) {
+        temp_guess_c[0][c] = T;
+        pres_guess_c[0][c] = p;
+      } else {
+        if (debug) *dcvo->os() << "       not admissible!" << std::endl;
+      }
+
+    } else if (batch_accept_[i] == EWC_ACCEPT_SMALLER_DT) {
+      // two ways to get a projected T past freezing point:
+      //  -- be on the lower branch and overshoot (ewc results in smaller dT)
+      //  -- be on the middle branch and get over the hump (ewc results in much larger dT)
+      double T_prev = T1[0][c];
+      if (T - T_prev < temp_guess_c[0][c] - T_prev) {
+        if (debug)
+          *dcvo->os() << "     dT_ewc < dT_std, on the lower branch, using EWC" << std::endl;
+        temp_guess_c[0][c] = T;
+        pres_guess_c[0][c] = p;
+      } else {
+        if (debug)
+          *dcvo->os() << "     dT_ewc > dT_std, on the middle branch, use std prediction"
+                      << std::endl;
+      }
+
+    } else {
+      // two ways to get a projected p to saturated:
+      //  -- be on the lower branch and overshoot (ewc results in smaller dp)
+      //  -- be on the middle branch and get over the hump (ewc results in much larger dp)
+      double p_prev = p1[0][c];
+      if (p - p_prev < pres_guess_c[0][c] - p_prev) {
+        if (debug)
+          *dcvo->os() << "     dp_ewc < dp_std, on the lower branch, using EWC" << std::endl;
+        temp_guess_c[0][c] = T;
+        pres_guess_c[0][c] = p;
+      } else {
+        if (debug)
+          *dcvo->os() << "     dp_ewc > dp_std, on the middle branch, use std prediction"
+                      << std::endl;
+      }
+    }
+  }
   return true;
 }
 
@@ -352,6 +347,11 @@ MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u, Teuchos:
   double dT_min = 0.01;
   double dp_min = 100.;
 
+  // Decide which cells need EWC, and how the inversion is to be used.  All
+  // inversions are then done at once.
+  batch_.clear();
+  batch_accept_.clear();
+
   int rank = mesh_->getComm()->MyPID();
   int ncells = cv.MyLength();
   for (int c = 0; c != ncells; ++c) {
@@ -396,9 +396,7 @@ MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u, Teuchos:
             wc_old[0][c] - (jac_[c](0, 0) * dp_std[0][c] + jac_[c](0, 1) * dT_std[0][c]);
           double e_ewc =
             e_old[0][c] - (jac_[c](1, 0) * dp_std[0][c] + jac_[c](1, 1) * dT_std[0][c]);
-          bool verbose = false;
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-            verbose = true;
             *dcvo->os() << std::setprecision(14) << "   Prev p,T: " << p_old[0][c] << ", "
                         << T_old[0][c] << std::endl
                         << "   Prev wc,e: " << wc_old[0][c] << ", " << e_old[0][c] << std::endl
@@ -414,34 +412,9 @@ MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u, Teuchos:
           }
 
           // -- invert for T,p at the projected ewc
-          double T(T_prev), p(p_old[0][c]);
-          int ierr = model_->InverseEvaluate(e_ewc / cv[0][c], wc_ewc / cv[0][c], T, p, verbose);
+          batch_.push_back(c, e_ewc / cv[0][c], wc_ewc / cv[0][c], T_prev, p_old[0][c]);
+          batch_accept_.push_back(EWC_ACCEPT_ALWAYS);
           ewc_completed = true;
-          if (ierr) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PRECON" << std::endl;
-            // pass, keep the T,p projections
-
-          } else {
-            double dT_ewc = T_old[0][c] - T;
-            double dp_ewc = p_old[0][c] - p;
-
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-              *dcvo->os() << "     kept within the transition zone." << std::endl
-                          << "   p,T_ewc = " << p << ", " << T << std::endl
-                          << "   dp,dT_ewc = " << dp_ewc << ", " << dT_ewc << std::endl;
-              if (std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) {
-                *dcvo->os() << "  sufficient change" << std::endl;
-              } else {
-                *dcvo->os() << "  insufficient change, trying anyway" << std::endl;
-              }
-            }
-
-            //            if (std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) {
-            dT_std[0][c] = dT_ewc;
-            dp_std[0][c] = dp_ewc;
-            //            }
-          }
         }
 
 #if EWC_PC_THAWING
@@ -475,42 +448,9 @@ MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u, Teuchos:
                         << "     wc,e_ewc = " << wc_ewc << ", " << e_ewc << std::endl;
 
           // -- invert for T,p at the projected ewc
-          double T(T_prev), p(p_old[0][c]);
-          int ierr = model_->InverseEvaluate(e_ewc / cv[0][c], wc_ewc / cv[0][c], T, p);
+          batch_.push_back(c, e_ewc / cv[0][c], wc_ewc / cv[0][c], T_prev, p_old[0][c]);
+          batch_accept_.push_back(EWC_ACCEPT_SMALLER_DT);
           ewc_completed = true;
-
-          if (ierr) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PRECON" << std::endl;
-            // pass, keep the T,p projections
-
-          } else {
-            double dT_ewc = T_old[0][c] - T;
-            double dp_ewc = p_old[0][c] - p;
-
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-              *dcvo->os() << "     within the transition zone." << std::endl
-                          << "   p,T_ewc = " << p << ", " << T << std::endl
-                          << "   dp,dT_ewc = " << dp_ewc << ", " << dT_ewc << std::endl;
-              if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) &&
-                  (std::abs(dT_ewc) < std::abs(dT_std[0][c]))) {
-                *dcvo->os()
-                  << "  sufficient change, and decreased dT (and so on the lower branch), using EWC"
-                  << std::endl;
-              } else if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min)) {
-                *dcvo->os() << "  increased dT (and so on the middle branch), using std"
-                            << std::endl;
-              } else {
-                *dcvo->os() << "  insufficient change, trying anyway" << std::endl;
-              }
-            }
-
-            //            if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) &&
-            if (std::abs(dT_ewc) < std::abs(dT_std[0][c])) {
-              dT_std[0][c] = dT_ewc;
-              dp_std[0][c] = dp_ewc;
-            }
-          }
         }
 #endif
       }
@@ -538,9 +478,7 @@ MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u, Teuchos:
               wc_old[0][c] - (jac_[c](0, 0) * dp_std[0][c] + jac_[c](0, 1) * dT_std[0][c]);
             double e_ewc =
               e_old[0][c] - (jac_[c](1, 0) * dp_std[0][c] + jac_[c](1, 1) * dT_std[0][c]);
-            bool verbose = false;
             if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-              verbose = true;
               *dcvo->os() << std::setprecision(14) << "   Prev p,T: " << p_old[0][c] << ", "
                           << T_old[0][c] << std::endl
                           << "   Prev wc,e: " << wc_old[0][c] << ", " << e_old[0][c] << std::endl
@@ -556,34 +494,9 @@ MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u, Teuchos:
             }
 
             // -- invert for T,p at the projected ewc
-            double T(T_prev), p(p_old[0][c]);
-            int ierr = model_->InverseEvaluate(e_ewc / cv[0][c], wc_ewc / cv[0][c], T, p, verbose);
+            batch_.push_back(c, e_ewc / cv[0][c], wc_ewc / cv[0][c], T_prev, p_old[0][c]);
+            batch_accept_.push_back(EWC_ACCEPT_ALWAYS);
             ewc_completed = true;
-            if (ierr) {
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "FAILED EWC PRECON" << std::endl;
-              // pass, keep the T,p projections
-
-            } else {
-              double dT_ewc = T_old[0][c] - T;
-              double dp_ewc = p_old[0][c] - p;
-
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-                *dcvo->os() << "     kept within the transition zone." << std::endl
-                            << "   p,T_ewc = " << p << ", " << T << std::endl
-                            << "   dp,dT_ewc = " << dp_ewc << ", " << dT_ewc << std::endl;
-                if (std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) {
-                  *dcvo->os() << "  sufficient change" << std::endl;
-                } else {
-                  *dcvo->os() << "  insufficient change, taking anyway" << std::endl;
-                }
-              }
-
-              //              if (std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) {
-              dT_std[0][c] = dT_ewc;
-              dp_std[0][c] = dp_ewc;
-              //              }
-            }
           }
 
 #  if EWC_PC_INCREASING_PRESSURE
@@ -617,43 +530,9 @@ MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u, Teuchos:
                           << "     wc,e_ewc = " << wc_ewc << ", " << e_ewc << std::endl;
 
             // -- invert for T,p at the projected ewc
-            double T(T_prev), p(p_old[0][c]);
-            int ierr = model_->InverseEvaluate(e_ewc / cv[0][c], wc_ewc / cv[0][c], T, p);
-
-            if (ierr) {
-              ewc_completed = true;
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "FAILED EWC PRECON" << std::endl;
-              // pass, keep the T,p projections
-
-            } else {
-              double dT_ewc = T_old[0][c] - T;
-              double dp_ewc = p_old[0][c] - p;
-
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
-                *dcvo->os() << "     within the transition zone." << std::endl
-                            << "   p,T_ewc = " << p << ", " << T << std::endl
-                            << "   dp,dT_ewc = " << dp_ewc << ", " << dT_ewc << std::endl;
-                if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) &&
-                    (std::abs(dp_ewc) < std::abs(dp_std[0][c]))) {
-                  *dcvo->os() << "  sufficient change, and decreased dp (and so on the lower "
-                                 "branch), using EWC"
-                              << std::endl;
-                } else if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min)) {
-                  *dcvo->os() << "  increased dp (and so on the middle branch), using std"
-                              << std::endl;
-                } else {
-                  *dcvo->os() << "  insufficient change, taking anyway" << std::endl;
-                }
-              }
-
-              //              if ((std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min) &&
-              if (std::abs(dp_ewc) < std::abs(dp_std[0][c])) {
-                ewc_completed = true;
-                dT_std[0][c] = dT_ewc;
-                dp_std[0][c] = dp_ewc;
-              }
-            }
+            batch_.push_back(c, e_ewc / cv[0][c], wc_ewc / cv[0][c], T_prev, p_old[0][c]);
+            batch_accept_.push_back(EWC_ACCEPT_SMALLER_DP);
+            ewc_completed = true;
           }
 #  endif
         }
@@ -661,6 +540,82 @@ MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u, Teuchos:
 #endif
     }
   }
+  // invert and use the results
+  model_->InverseEvaluateBatch(S_.ptr(), batch_);
+  ReportInverseBatch_("preconditioner");
+
+  for (int i = 0; i != batch_.size(); ++i) {
+    int c = batch_.cells[i];
+    Teuchos::RCP<VerboseObject> dcvo = Teuchos::null;
+    if (vo_->os_OK(Teuchos::VERB_EXTREME)) dcvo = db_->GetVerboseObject(c, rank);
+    Teuchos::OSTab dctab = dcvo == Teuchos::null ? vo_->getOSTab() : dcvo->getOSTab();
+    bool debug = dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME);
+
+    if (batch_.ierr[i]) {
+      if (debug)
+        *dcvo->os() << "FAILED EWC PRECON: c = " << c << ", ierr = " << batch_.ierr[i]
+                    << std::endl;
+      continue; // keep the std correction
+    }
+
+    double dT_ewc = T_old[0][c] - batch_.T[i];
+    double dp_ewc = p_old[0][c] - batch_.p[i];
+    bool sufficient = std::abs(dT_ewc) > dT_min || std::abs(dp_ewc) > dp_min;
+    if (debug)
+      *dcvo->os() << std::setprecision(14) << "EWC precon: c = " << c << std::endl
+                  << "     within the transition zone, " << batch_.iterations[i]
+                  << " iterations." << std::endl
+                  << "   p,T_ewc = " << batch_.p[i] << ", " << batch_.T[i] << std::endl
+                  << "   dp,dT_ewc = " << dp_ewc << ", " << dT_ewc << std::endl;
+
+    if (batch_accept_[i] == EWC_ACCEPT_ALWAYS) {
+      if (debug) {
+        if (sufficient) {
+          *dcvo->os() << "  sufficient change" << std::endl;
+        } else {
+          *dcvo->os() << "  insufficient change, taking anyway" << std::endl;
+        }
+      }
+      dT_std[0][c] = dT_ewc;
+      dp_std[0][c] = dp_ewc;
+
+    } else if (batch_accept_[i] == EWC_ACCEPT_SMALLER_DT) {
+      bool smaller = std::abs(dT_ewc) < std::abs(dT_std[0][c]);
+      if (debug) {
+        if (sufficient && smaller) {
+          *dcvo->os()
+            << "  sufficient change, and decreased dT (and so on the lower branch), using EWC"
+            << std::endl;
+        } else if (sufficient) {
+          *dcvo->os() << "  increased dT (and so on the middle branch), using std" << std::endl;
+        } else {
+          *dcvo->os() << "  insufficient change, trying anyway" << std::endl;
+        }
+      }
+      if (smaller) {
+        dT_std[0][c] = dT_ewc;
+        dp_std[0][c] = dp_ewc;
+      }
+
+    } else {
+      bool smaller = std::abs(dp_ewc) < std::abs(dp_std[0][c]);
+      if (debug) {
+        if (sufficient && smaller) {
+          *dcvo->os() << "  sufficient change, and decreased dp (and so on the lower branch), "
+                         "using EWC"
+                      << std::endl;
+        } else if (sufficient) {
+          *dcvo->os() << "  increased dp (and so on the middle branch), using std" << std::endl;
+        } else {
+          *dcvo->os() << "  insufficient change, taking anyway" << std::endl;
+        }
+      }
+      if (smaller) {
+        dT_std[0][c] = dT_ewc;
+        dp_std[0][c] = dp_ewc;
+      }
+    }
+  }
 }
 
 } // namespace Amanzi
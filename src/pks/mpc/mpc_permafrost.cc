@@ -23,6 +23,7 @@
 #include "pk_helpers.hh"
 
 #include "mpc_permafrost.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 
@@ -406,6 +407,7 @@ MPCPermafrost::FunctionalResidual(double t_old,
                                   Teuchos::RCP<TreeVector> u_new,
                                   Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
   // propagate updated info into state
   Solution_to_State(*u_new, tag_next_);
 
@@ -453,6 +455,7 @@ MPCPermafrost::FunctionalResidual(double t_old,
 int
 MPCPermafrost::ApplyPreconditioner(Teuchos::RCP<const TreeVector> r, Teuchos::RCP<TreeVector> Pr)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon application:" << std::endl;
 
@@ -519,6 +522,7 @@ MPCPermafrost::ApplyPreconditioner(Teuchos::RCP<const TreeVector> r, Teuchos::RC
 void
 MPCPermafrost::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
 
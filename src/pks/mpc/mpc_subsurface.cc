@@ -30,6 +30,7 @@ with freezing.
 #include "richards.hh"
 #include "mpc_delegate_ewc_subsurface.hh"
 #include "mpc_subsurface.hh"
+#include "ProfileTimer.hh"
 
 #define DEBUG_FLAG 1
 
@@ -520,6 +521,7 @@ MPCSubsurface::ModifyPredictor(double h,
 void
 MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
 
   if (precon_type_ == PRECON_NONE) {
@@ -730,6 +732,7 @@ MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
 int
 MPCSubsurface::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon application:" << std::endl;
 
@@ -29,6 +29,7 @@ with freezing.
 
 #include "mpc_delegate_ewc_surface.hh"
 #include "mpc_surface.hh"
+#include "ProfileTimer.hh"
 
 #define DEBUG_FLAG 1
 
@@ -228,6 +229,7 @@ MPCSurface::ModifyPredictor(double h,
 void
 MPCSurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
 
   if (precon_type_ == PRECON_NONE) {
@@ -290,6 +292,7 @@ MPCSurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
 int
 MPCSurface::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon application:" << std::endl;
 
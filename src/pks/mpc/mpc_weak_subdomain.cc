@@ -22,12 +22,40 @@ input spec.
 
 */
 
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "mpi.h"
+#include "Kokkos_Core.hpp"
+#include "Teuchos_StackedTimer.hpp"
+#include "Teuchos_TimeMonitor.hpp"
 
 #include "mpc_weak_subdomain.hh"
 
 
 namespace Amanzi {
 
+namespace {
+// dynamic scheduling, as subdomains may take very different numbers of steps
+using SubdomainPolicy =
+  Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace, Kokkos::Schedule<Kokkos::Dynamic>>;
+
+// The stacked timer is global and not thread-safe, so it is detached while
+// subdomains are advanced concurrently and reattached on exit.
+struct StackedTimerGuard {
+  StackedTimerGuard() : timer(Teuchos::TimeMonitor::getStackedTimer())
+  {
+    Teuchos::TimeMonitor::setStackedTimer(Teuchos::null);
+  }
+  ~StackedTimerGuard() { Teuchos::TimeMonitor::setStackedTimer(timer); }
+
+  Teuchos::RCP<Teuchos::StackedTimer> timer;
+};
+} // namespace
+
 
 MPCWeakSubdomain::MPCWeakSubdomain(Teuchos::ParameterList& FElist,
                                    const Teuchos::RCP<Teuchos::ParameterList>& plist,
@@ -43,6 +71,20 @@ MPCWeakSubdomain::MPCWeakSubdomain(Teuchos::ParameterList& FElist,
     internal_subcycling_target_dt_ =
       plist_->template get<double>("subcycling target time step [s]");
   }
+  parallel_subdomains_ = plist_->template get<bool>("advance subdomains in parallel", false);
+
+  // sub-PKs call MPI on their subdomain's communicator from each thread
+  if (parallel_subdomains_) {
+    int provided;
+    MPI_Query_thread(&provided);
+    if (provided != MPI_THREAD_MULTIPLE) {
+      parallel_subdomains_ = false;
+      if (vo_->os_OK(Teuchos::VERB_LOW)) {
+        *vo_->os() << "WARNING: advancing subdomains in parallel requires MPI_THREAD_MULTIPLE; "
+                   << "advancing subdomains serially." << std::endl;
+      }
+    }
+  }
 };
 
 
@@ -149,6 +191,8 @@ MPCWeakSubdomain::Setup()
 void
 MPCWeakSubdomain::Initialize()
 {
+  if (parallel_subdomains_) CheckSubdomainsIndependent_();
+
   if (internal_subcycling_) {
     const auto& ds = S_->GetDomainSet(ds_name_);
     for (const auto& subdomain : *ds) {
@@ -160,6 +204,55 @@ MPCWeakSubdomain::Initialize()
 }
 
 
+// -----------------------------------------------------------------------------
+// Subdomains advanced concurrently must not update shared evaluators.  Checks
+// that no evaluator of the first subdomain on this rank, i.e. of a key in a
+// domain set with that subdomain's index, depends on an evaluator of a key
+// that is in no domain set.  Requires the evaluators of State::Setup().
+// -----------------------------------------------------------------------------
+void
+MPCWeakSubdomain::CheckSubdomainsIndependent_()
+{
+  const auto& ds = S_->GetDomainSet(ds_name_);
+  if (ds->begin() == ds->end()) return;
+
+  KeyTriple subdomain_split;
+  Keys::splitDomainSet(*ds->begin(), subdomain_split);
+  const std::string& index = std::get<1>(subdomain_split);
+
+  std::vector<KeyTag> own, shared;
+  for (auto rs = S_->data_begin(); rs != S_->data_end(); ++rs) {
+    const Key& key = rs->first;
+    KeyTriple split;
+    bool in_set = Keys::splitDomainSet(Keys::getDomain(key), split);
+    if (in_set && std::get<1>(split) != index) continue;
+
+    for (const auto& entry : *rs->second) {
+      if (!S_->HasEvaluator(key, entry.first)) continue;
+      if (in_set)
+        own.emplace_back(key, entry.first);
+      else
+        shared.emplace_back(key, entry.first);
+    }
+  }
+
+  for (const auto& own_kt : own) {
+    const auto& eval = S_->GetEvaluator(own_kt.first, own_kt.second);
+    for (const auto& shared_kt : shared) {
+      if (eval.IsDependency(*S_, shared_kt.first, shared_kt.second)) {
+        Errors::Message msg;
+        msg << "MPCWeakSubdomain \"" << name() << "\": \"advance subdomains in parallel\" "
+            << "requires independent subdomains, but \""
+            << Keys::getKey(own_kt.first, own_kt.second) << "\" depends on \""
+            << Keys::getKey(shared_kt.first, shared_kt.second)
+            << "\", which is not in a domain set.";
+        Exceptions::amanzi_throw(msg);
+      }
+    }
+  }
+}
+
+
 // -----------------------------------------------------------------------------
 // Advance each sub-PK individually.
 // -----------------------------------------------------------------------------
@@ -179,9 +272,34 @@ bool
 MPCWeakSubdomain::AdvanceStep_Standard_(double t_old, double t_new, bool reinit)
 {
   bool fail = false;
-  for (auto& pk : sub_pks_) {
-    fail = pk->AdvanceStep(t_old, t_new, reinit);
-    if (fail) break;
+  if (parallel_subdomains_) {
+    // all subdomains are advanced, even if one fails, and exceptions are
+    // rethrown once all are done
+    int n = sub_pks_.size();
+    std::vector<int> sub_fail(n, 0);
+    std::vector<std::exception_ptr> sub_error(n);
+    StackedTimerGuard timer_guard;
+    Kokkos::parallel_for(
+      "MPCWeakSubdomain::AdvanceStep_Standard",
+      SubdomainPolicy(0, n),
+      [&](const int i) {
+        try {
+          sub_fail[i] = sub_pks_[i]->AdvanceStep(t_old, t_new, reinit);
+        } catch (...) {
+          sub_error[i] = std::current_exception();
+        }
+      });
+
+    for (const auto& error : sub_error) {
+      if (error) std::rethrow_exception(error);
+    }
+    fail = std::any_of(sub_fail.begin(), sub_fail.end(), [](int f) { return f; });
+
+  } else {
+    for (auto& pk : sub_pks_) {
+      fail = pk->AdvanceStep(t_old, t_new, reinit);
+      if (fail) break;
+    }
   }
 
   int sub_fail_i = fail ? 1 : 0;
@@ -198,67 +316,62 @@ bool
 MPCWeakSubdomain::AdvanceStep_InternalSubcycling_(double t_old, double t_new, bool reinit)
 {
   Teuchos::OSTab tab = vo_->getOSTab();
-  bool fail = false;
   if (vo_->os_OK(Teuchos::VERB_EXTREME))
     *vo_->os() << "Beginning subcycled timestepping." << std::endl;
 
-  const auto& ds = *S_->GetDomainSet(ds_name_);
-  int my_pid = solution_->Comm()->MyPID();
+  std::vector<std::string> subdomains;
+  std::vector<SubcycleRecords> records;
+  for (const auto& subdomain : *S_->GetDomainSet(ds_name_)) {
+    subdomains.push_back(subdomain);
+    records.push_back(getSubcycleRecords_(subdomain));
+  }
+  int n = subdomains.size();
 
-  int i = 0;
   int n_throw = 0;
   std::string throw_msg;
-  for (const auto& subdomain : ds) {
-    double dt_inner = -1;
-    double t_inner = t_old;
-    try { // must catch non-collective throws for TimeStepCrash
-      if (vo_->os_OK(Teuchos::VERB_EXTREME))
-        *vo_->os() << "Beginning subcyling on pk \"" << sub_pks_[i]->name() << "\"" << std::endl;
-
-      bool done = false;
-      Tag tag_subcycle_current = get_ds_tag_current_(subdomain);
-      Tag tag_subcycle_next = get_ds_tag_next_(subdomain);
-
-      S_->set_time(tag_subcycle_current, t_old);
-      while (!done) {
-        dt_inner = std::min(sub_pks_[i]->get_dt(), t_new - t_inner);
-        S_->Assign("dt", tag_subcycle_next, name(), dt_inner);
-        S_->set_time(tag_subcycle_next, t_inner + dt_inner);
-        bool fail_inner = sub_pks_[i]->AdvanceStep(t_inner, t_inner + dt_inner, false);
-        if (vo_->os_OK(Teuchos::VERB_EXTREME))
-          *vo_->os() << "  step failed? " << fail_inner << std::endl;
-        bool valid_inner = sub_pks_[i]->ValidStep();
-        if (vo_->os_OK(Teuchos::VERB_EXTREME)) {
-          *vo_->os() << "  step valid? " << valid_inner << std::endl;
+  if (parallel_subdomains_) {
+    // Subdomains are independent, each with its own tags.  Crashes are
+    // collected per subdomain so that the others may finish, and any other
+    // exception is rethrown once all are done.
+    std::vector<std::string> sub_throw_msg(n);
+    std::vector<std::exception_ptr> sub_error(n);
+    StackedTimerGuard timer_guard;
+    Kokkos::parallel_for(
+      "MPCWeakSubdomain::AdvanceStep_InternalSubcycling",
+      SubdomainPolicy(0, n),
+      [&](const int i) {
+        try {
+          AdvanceSubdomain_InternalSubcycling_(i, subdomains[i], records[i], t_old, t_new, false);
+        } catch (Errors::TimeStepCrash& e) {
+          sub_throw_msg[i] = e.what();
+          if (sub_throw_msg[i].empty()) sub_throw_msg[i] = "TimeStepCrash";
+        } catch (...) {
+          sub_error[i] = std::current_exception();
         }
+      });
 
-        if (fail_inner || !valid_inner) {
-          sub_pks_[i]->FailStep(t_old, t_new, tag_subcycle_next);
-
-          dt_inner = sub_pks_[i]->get_dt();
-          S_->set_time(tag_subcycle_next, S_->get_time(tag_subcycle_current));
-
-          if (vo_->os_OK(Teuchos::VERB_EXTREME))
-            *vo_->os() << "  failed, new timestep is " << dt_inner << std::endl;
-
-        } else {
-          sub_pks_[i]->CommitStep(t_inner, t_inner + dt_inner, tag_subcycle_next);
-          t_inner += dt_inner;
-          if (std::abs(t_new - t_inner) < 1.e-10) done = true;
-
-          S_->set_time(tag_subcycle_current, S_->get_time(tag_subcycle_next));
-          S_->advance_cycle(tag_subcycle_next);
+    for (const auto& error : sub_error) {
+      if (error) std::rethrow_exception(error);
+    }
+    for (int i = 0; i != n; ++i) {
+      if (sub_throw_msg[i].empty()) continue;
+      if (n_throw == 0) throw_msg = sub_throw_msg[i];
+      n_throw++;
+    }
+    if (n_throw > 1) {
+      throw_msg += "  (first of " + std::to_string(n_throw) + " failed subdomains)";
+    }
 
-          dt_inner = sub_pks_[i]->get_dt();
-          if (vo_->os_OK(Teuchos::VERB_EXTREME))
-            *vo_->os() << "  success, new timestep is " << dt_inner << std::endl;
-        }
+  } else {
+    for (int i = 0; i != n; ++i) {
+      try { // must catch non-collective throws for TimeStepCrash
+        AdvanceSubdomain_InternalSubcycling_(
+          i, subdomains[i], records[i], t_old, t_new, vo_->os_OK(Teuchos::VERB_EXTREME));
+      } catch (Errors::TimeStepCrash& e) {
+        n_throw++;
+        throw_msg = e.what();
+        break;
       }
-      i++;
-    } catch (Errors::TimeStepCrash& e) {
-      n_throw++;
-      throw_msg = e.what();
-      break;
     }
   }
 
@@ -279,6 +392,80 @@ MPCWeakSubdomain::AdvanceStep_InternalSubcycling_(double t_old, double t_new, bo
 }
 
 
+//-------------------------------------------------------------------------------------
+// Look up the State records written while subcycling a subdomain.  This must
+// be done serially, so that concurrent subdomains only write through these.
+//-------------------------------------------------------------------------------------
+MPCWeakSubdomain::SubcycleRecords
+MPCWeakSubdomain::getSubcycleRecords_(const std::string& subdomain)
+{
+  Tag tag_subcycle_current = get_ds_tag_current_(subdomain);
+  Tag tag_subcycle_next = get_ds_tag_next_(subdomain);
+
+  SubcycleRecords records;
+  records.time_current = &S_->GetW<double>("time", tag_subcycle_current, "time");
+  records.time_next = &S_->GetW<double>("time", tag_subcycle_next, "time");
+  records.cycle_next = &S_->GetW<int>("cycle", tag_subcycle_next, "cycle");
+  records.dt_next = &S_->GetW<double>("dt", tag_subcycle_next, name());
+  return records;
+}
+
+
+//-------------------------------------------------------------------------------------
+// Subcycle sub_pks_[i] from t_old to t_new.  This touches only data of that
+// subdomain and its tags, and writes State only through records, and so may
+// be called concurrently for different subdomains, in which case verbose must
+// be false.
+//-------------------------------------------------------------------------------------
+void
+MPCWeakSubdomain::AdvanceSubdomain_InternalSubcycling_(int i,
+                                                       const std::string& subdomain,
+                                                       const SubcycleRecords& records,
+                                                       double t_old,
+                                                       double t_new,
+                                                       bool verbose)
+{
+  if (verbose)
+    *vo_->os() << "Beginning subcyling on pk \"" << sub_pks_[i]->name() << "\"" << std::endl;
+
+  double dt_inner = -1;
+  double t_inner = t_old;
+  bool done = false;
+  Tag tag_subcycle_next = get_ds_tag_next_(subdomain);
+
+  *records.time_current = t_old;
+  while (!done) {
+    dt_inner = std::min(sub_pks_[i]->get_dt(), t_new - t_inner);
+    *records.dt_next = dt_inner;
+    *records.time_next = t_inner + dt_inner;
+    bool fail_inner = sub_pks_[i]->AdvanceStep(t_inner, t_inner + dt_inner, false);
+    if (verbose) *vo_->os() << "  step failed? " << fail_inner << std::endl;
+    bool valid_inner = sub_pks_[i]->ValidStep();
+    if (verbose) { *vo_->os() << "  step valid? " << valid_inner << std::endl; }
+
+    if (fail_inner || !valid_inner) {
+      sub_pks_[i]->FailStep(t_old, t_new, tag_subcycle_next);
+
+      dt_inner = sub_pks_[i]->get_dt();
+      *records.time_next = *records.time_current;
+
+      if (verbose) *vo_->os() << "  failed, new timestep is " << dt_inner << std::endl;
+
+    } else {
+      sub_pks_[i]->CommitStep(t_inner, t_inner + dt_inner, tag_subcycle_next);
+      t_inner += dt_inner;
+      if (std::abs(t_new - t_inner) < 1.e-10) done = true;
+
+      *records.time_current = *records.time_next;
+      ++(*records.cycle_next);
+
+      dt_inner = sub_pks_[i]->get_dt();
+      if (verbose) *vo_->os() << "  success, new timestep is " << dt_inner << std::endl;
+    }
+  }
+}
+
+
 void
 MPCWeakSubdomain::CommitStep(double t_old, double t_new, const Tag& tag_next)
 {
@@ -14,6 +14,35 @@
   means that the number of PKs is not known a priori -- it depends on a domain
   set.
 
+  Subdomains are independent, so those on a rank may be advanced
+  concurrently by host threads.  This requires that the sub-PKs only touch
+  data of their own subdomain and tags, which is the case for the usual column
+  models.  At initialization, the evaluators of a subdomain are checked not to
+  depend on evaluators of keys outside of domain sets, e.g. of the parent
+  domain, which would be updated by several threads at once.  Evaluators of
+  all subdomains are created from the same lists, so only the first
+  subdomain of each rank is checked.  State records of the subcycling tags
+  are looked up before threads start, and the Teuchos stacked timer is
+  detached while they run.  Sub-PK output is still written, but lines of
+  different subdomains may interleave, so sub-PK verbosity should be kept
+  low.
+
+.. _mpc-weak-subdomain-spec:
+.. admonition:: mpc-weak-subdomain-spec
+
+    * `"subcycle`" ``[bool]`` **false** Subcycle each subdomain independently
+      to the coupler's time step.
+    * `"subcycling target time step [s]`" ``[double]`` Required if
+      `"subcycle`" is true, the time step of the coupler.
+    * `"advance subdomains in parallel`" ``[bool]`` **false** Advance the
+      subdomains of each rank concurrently, using all host threads.  A failed
+      step or crash of one subdomain does not stop the others, and is reported
+      as in the serial case once all are done.  Subdomains must be
+      independent, see above; otherwise initialization throws.  This requires
+      MPI to be initialized by MPI_Init_thread() with MPI_THREAD_MULTIPLE,
+      which the `ats` executable requests; if MPI does not provide it, a
+      warning is written and subdomains are advanced serially.
+
  */
 
 #pragma once
@@ -44,8 +73,25 @@ class MPCWeakSubdomain : public MPC<PK> {
  protected:
   void init_();
 
+  // State records of a subdomain's subcycling tags
+  struct SubcycleRecords {
+    double* time_current;
+    double* time_next;
+    int* cycle_next;
+    double* dt_next;
+  };
+
   bool AdvanceStep_Standard_(double t_old, double t_new, bool reinit);
   bool AdvanceStep_InternalSubcycling_(double t_old, double t_new, bool reinit);
+  SubcycleRecords getSubcycleRecords_(const std::string& subdomain);
+  void AdvanceSubdomain_InternalSubcycling_(int i,
+                                            const std::string& subdomain,
+                                            const SubcycleRecords& records,
+                                            double t_old,
+                                            double t_new,
+                                            bool verbose);
+
+  void CheckSubdomainsIndependent_();
 
   Tag get_ds_tag_next_(const std::string& subdomain);
   Tag get_ds_tag_current_(const std::string& subdomain);
@@ -54,6 +100,7 @@ class MPCWeakSubdomain : public MPC<PK> {
   bool internal_subcycling_;
   double internal_subcycling_target_dt_;
   double cycle_dt_;
+  bool parallel_subdomains_;
   Key ds_name_;
 
  private:
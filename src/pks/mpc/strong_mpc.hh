@@ -28,6 +28,7 @@ Globally implicit coupling solves all sub-PKs as a single system of equations.
 
 #include "mpc.hh"
 #include "pk_bdf_default.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 
@@ -200,6 +201,7 @@ StrongMPC<PK_t>::FunctionalResidual(double t_old,
                                     Teuchos::RCP<TreeVector> u_new,
                                     Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", this->name(), "FunctionalResidual");
   Solution_to_State(*u_new, tag_next_);
 
   // loop over sub-PKs
@@ -241,6 +243,7 @@ template <class PK_t>
 int
 StrongMPC<PK_t>::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", this->name(), "ApplyPreconditioner");
   // loop over sub-PKs
   int ierr = 0;
   for (std::size_t i = 0; i != sub_pks_.size(); ++i) {
@@ -307,6 +310,7 @@ template <class PK_t>
 void
 StrongMPC<PK_t>::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", this->name(), "UpdatePreconditioner");
   Solution_to_State(*up, tag_next_);
 
   // loop over sub-PKs
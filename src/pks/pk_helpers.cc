@@ -277,8 +277,10 @@ advanceChemistry(Teuchos::RCP<AmanziChemistry::Chemistry_PK> chem_pk,
   }
   if (fail) return fail;
 
-  *tcc = *chem_pk->aqueous_components();
-  convertConcentrationToATS(mol_dens, num_aqueous, *tcc, *tcc);
+  // Chemistry works on tcc in place, in which case this converts in place.
+  // Otherwise, convert from chemistry's vector directly into tcc, rather than
+  // copying it into tcc first.
+  convertConcentrationToATS(mol_dens, num_aqueous, *chem_pk->aqueous_components(), *tcc);
   return fail;
 }
 
@@ -16,6 +16,7 @@ PKPhysicalBase and BDF methods of PK_BDF_Default.
 
 #include "pk_helpers.hh"
 #include "pk_physical_bdf_default.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 
@@ -77,6 +78,7 @@ int
 PK_PhysicalBDF_Default::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
                                             Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   *Pu = *u;
   return 0;
 }
@@ -105,13 +107,9 @@ PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
 
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_->get_time(tag_next_) - S_->get_time(tag_current_);
+  bool verbose = vo_->os_OK(Teuchos::VERB_MEDIUM);
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->getComm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
-
-  double enorm_val = 0.0;
+  std::vector<ENorm_t> enorms;
   for (CompositeVector::name_iterator comp = dvec->begin(); comp != dvec->end(); ++comp) {
     double enorm_comp = 0.0;
     int enorm_loc = -1;
@@ -120,36 +118,49 @@ PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
     if (*comp == "cell") {
       // error done relative to extensive, conserved quantity
       int ncells = dvec->size(*comp, false);
-      for (unsigned int c = 0; c != ncells; ++c) {
-        double enorm_c =
-          std::abs(h * dvec_v[0][c]) / (atol_ * cv[0][c] + rtol_ * std::abs(conserved[0][c]));
+      auto enorm_c = [&](int c) {
         AMANZI_ASSERT((atol_ * cv[0][c] + rtol_ * std::abs(conserved[0][c])) > 0.);
-
-        if (enorm_c > enorm_comp) {
-          enorm_comp = enorm_c;
-          enorm_loc = c;
+        return std::abs(h * dvec_v[0][c]) / (atol_ * cv[0][c] + rtol_ * std::abs(conserved[0][c]));
+      };
+
+      // the location of the maximum is only needed for output, and the
+      // maximum alone vectorizes
+      if (verbose) {
+        for (int c = 0; c != ncells; ++c) {
+          double enorm_c_val = enorm_c(c);
+          if (enorm_c_val > enorm_comp) {
+            enorm_comp = enorm_c_val;
+            enorm_loc = c;
+          }
         }
+      } else {
+        for (int c = 0; c != ncells; ++c) enorm_comp = std::max(enorm_comp, enorm_c(c));
       }
 
     } else if (*comp == std::string("face")) {
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
-
-      for (unsigned int f = 0; f != nfaces; ++f) {
-        auto cells = mesh_->getFaceCells(f);
-        double cv_min =
-          cells.size() == 1 ? cv[0][cells[0]] : std::min(cv[0][cells[0]], cv[0][cells[1]]);
-        double conserved_min = cells.size() == 1 ?
-                                 conserved[0][cells[0]] :
-                                 std::min(conserved[0][cells[0]], conserved[0][cells[1]]);
-
-        double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f]) /
-                         (atol_ * cv_min + rtol_ * std::abs(conserved_min));
+      const auto& face_cells = FaceCells_();
+      auto enorm_f = [&](int f) {
+        int c0 = face_cells[2 * f];
+        int c1 = face_cells[2 * f + 1];
+        double cv_min = std::min(cv[0][c0], cv[0][c1]);
+        double conserved_min = std::min(conserved[0][c0], conserved[0][c1]);
         AMANZI_ASSERT((atol_ * cv_min + rtol_ * std::abs(conserved_min)) > 0.);
-        if (enorm_f > enorm_comp) {
-          enorm_comp = enorm_f;
-          enorm_loc = f;
+        return fluxtol_ * h * std::abs(dvec_v[0][f]) /
+               (atol_ * cv_min + rtol_ * std::abs(conserved_min));
+      };
+
+      if (verbose) {
+        for (int f = 0; f != nfaces; ++f) {
+          double enorm_f_val = enorm_f(f);
+          if (enorm_f_val > enorm_comp) {
+            enorm_comp = enorm_f_val;
+            enorm_loc = f;
+          }
         }
+      } else {
+        for (int f = 0; f != nfaces; ++f) enorm_comp = std::max(enorm_comp, enorm_f(f));
       }
 
     } else {
@@ -158,34 +169,98 @@ PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       //      AMANZI_ASSERT(norm < 1.e-15);
     }
 
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
+    ENorm_t enorm;
+    enorm.value = enorm_comp;
+    enorm.gid = dvec_v.Map().GID(enorm_loc);
+    enorms.push_back(enorm);
+  }
 
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
+  return ReduceErrorNorm_(*dvec, enorms);
+};
 
-      int ierr;
 
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] ("
-                 << infnorm << ")" << std::endl;
+const std::vector<AmanziMesh::Entity_ID>&
+PK_PhysicalBDF_Default::FaceCells_()
+{
+  if (face_cells_.empty()) {
+    int nfaces =
+      mesh_->getNumEntities(AmanziMesh::Entity_kind::FACE, AmanziMesh::Parallel_kind::OWNED);
+    face_cells_.resize(2 * nfaces);
+    for (int f = 0; f != nfaces; ++f) {
+      auto cells = mesh_->getFaceCells(f);
+      face_cells_[2 * f] = cells[0];
+      face_cells_[2 * f + 1] = cells.size() == 1 ? cells[0] : cells[1];
     }
+  }
+  return face_cells_;
+}
 
-    enorm_val = std::max(enorm_val, enorm_comp);
+
+const std::vector<AmanziMesh::Entity_ID>&
+PK_PhysicalBDF_Default::BoundaryFaces_()
+{
+  // a rank may own no boundary faces, so empty does not mean unbuilt
+  if (!boundary_faces_built_) {
+    const auto& face_cells = FaceCells_();
+    int nfaces = face_cells.size() / 2;
+    for (int f = 0; f != nfaces; ++f) {
+      if (face_cells[2 * f] == face_cells[2 * f + 1]) boundary_faces_.push_back(f);
+    }
+    boundary_faces_built_ = true;
   }
+  return boundary_faces_;
+}
 
-  double enorm_val_l = enorm_val;
+
+double
+PK_PhysicalBDF_Default::ReduceErrorNorm_(const CompositeVector& dvec,
+                                         const std::vector<ENorm_t>& enorms)
+{
+  Teuchos::RCP<const Comm_type> comm_p = mesh_->getComm();
+  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
+    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
+  const MPI_Comm& comm = mpi_comm_p->Comm();
 
   int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
+  int ncomp = enorms.size();
+  if (!vo_->os_OK(Teuchos::VERB_MEDIUM)) {
+    double enorm_val_l = 0.0;
+    for (const auto& enorm : enorms) enorm_val_l = std::max(enorm_val_l, enorm.value);
+
+    double enorm_val;
+    ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
+    AMANZI_ASSERT(!ierr);
+    return enorm_val;
+  }
+
+  // norms with their locations, followed by inf norms of each component
+  std::vector<ENorm_t> l_errs(enorms);
+  for (CompositeVector::name_iterator comp = dvec.begin(); comp != dvec.end(); ++comp) {
+    const Epetra_MultiVector& dvec_v = *dvec.ViewComponent(*comp, false);
+    ENorm_t infnorm;
+    infnorm.value = 0.;
+    infnorm.gid = 0;
+    for (int k = 0; k != dvec_v.NumVectors(); ++k) {
+      for (int i = 0; i != dvec_v.MyLength(); ++i) {
+        infnorm.value = std::max(infnorm.value, std::abs(dvec_v[k][i]));
+      }
+    }
+    l_errs.push_back(infnorm);
+  }
+
+  std::vector<ENorm_t> errs(l_errs.size());
+  ierr = MPI_Allreduce(l_errs.data(), errs.data(), errs.size(), MPI_DOUBLE_INT, MPI_MAXLOC, comm);
   AMANZI_ASSERT(!ierr);
+
+  double enorm_val = 0.0;
+  int i = 0;
+  for (CompositeVector::name_iterator comp = dvec.begin(); comp != dvec.end(); ++comp, ++i) {
+    *vo_->os() << "  ENorm (" << *comp << ") = " << errs[i].value << "[" << errs[i].gid << "] ("
+               << errs[ncomp + i].value << ")" << std::endl;
+    enorm_val = std::max(enorm_val, errs[i].value);
+  }
   return enorm_val;
-};
+}
 
 
 void
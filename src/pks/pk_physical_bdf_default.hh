@@ -55,6 +55,8 @@ code, so usually are not supplied by the user.
 #ifndef ATS_PK_PHYSICAL_BDF_BASE_HH_
 #define ATS_PK_PHYSICAL_BDF_BASE_HH_
 
+#include <vector>
+
 #include "errors.hh"
 #include "pk_bdf_default.hh"
 #include "pk_physical_default.hh"
@@ -117,6 +119,20 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default, public PK_Physical_Default
   std::vector<double>& bc_values() { return bc_->bc_value(); }
   Teuchos::RCP<Operators::BCs> BCs() { return bc_; }
 
+ protected:
+  // The one or two cells of each owned face, the first repeated for
+  // boundary faces, computed once.
+  const std::vector<AmanziMesh::Entity_ID>& FaceCells_();
+
+  // The owned faces on the boundary, computed once, for defaulting faces
+  // without a boundary condition.
+  const std::vector<AmanziMesh::Entity_ID>& BoundaryFaces_();
+
+  // Reduces per-component error norms of dvec, in its component order, to
+  // the global maximum, writing each component's norm, location, and inf
+  // norm if verbose.  This is a single collective call.
+  double ReduceErrorNorm_(const CompositeVector& dvec, const std::vector<ENorm_t>& enorms);
+
  protected:
   // PC
   Teuchos::RCP<Operators::Operator> preconditioner_;
@@ -128,6 +144,11 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default, public PK_Physical_Default
   Key conserved_key_;
   Key cell_vol_key_;
   double atol_, rtol_, fluxtol_;
+
+ private:
+  std::vector<AmanziMesh::Entity_ID> face_cells_;
+  std::vector<AmanziMesh::Entity_ID> boundary_faces_;
+  bool boundary_faces_built_ = false;
 };
 
 
@@ -0,0 +1,112 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include "mpi.h"
+
+#include "dbc.hh"
+#include "errors.hh"
+
+#include "reductions.hh"
+
+namespace Amanzi {
+
+Reductions::Reductions(const Teuchos::RCP<const Comm_type>& comm)
+  : comm_(comm), reduced_(false)
+{}
+
+
+int
+Reductions::Register_(Op op, double local)
+{
+  if (reduced_) {
+    Errors::Message message(
+      "Reductions: values may not be registered after Reduce(), without first calling Clear().");
+    Exceptions::amanzi_throw(message);
+  }
+  ops_.push_back(op);
+  values_.push_back(local);
+  return ops_.size() - 1;
+}
+
+
+void
+Reductions::Reduce()
+{
+  AMANZI_ASSERT(!reduced_);
+
+  // pack sums, and maxes with negated mins
+  std::vector<double> sums, maxes;
+  for (int i = 0; i != ops_.size(); ++i) {
+    if (ops_[i] == Op::SUM) {
+      sums.push_back(values_[i]);
+    } else {
+      maxes.push_back(ops_[i] == Op::MAX ? values_[i] : -values_[i]);
+    }
+  }
+
+  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
+    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_);
+  const MPI_Comm& comm = mpi_comm_p->Comm();
+
+  std::vector<double> g_sums(sums.size()), g_maxes(maxes.size());
+  MPI_Request requests[2];
+  int nrequests = 0;
+  int ierr = 0;
+  if (!sums.empty()) {
+    ierr |= MPI_Iallreduce(sums.data(),
+                           g_sums.data(),
+                           sums.size(),
+                           MPI_DOUBLE,
+                           MPI_SUM,
+                           comm,
+                           &requests[nrequests++]);
+  }
+  if (!maxes.empty()) {
+    ierr |= MPI_Iallreduce(maxes.data(),
+                           g_maxes.data(),
+                           maxes.size(),
+                           MPI_DOUBLE,
+                           MPI_MAX,
+                           comm,
+                           &requests[nrequests++]);
+  }
+  ierr |= MPI_Waitall(nrequests, requests, MPI_STATUSES_IGNORE);
+  AMANZI_ASSERT(!ierr);
+
+  // unpack
+  int i_sum = 0, i_max = 0;
+  for (int i = 0; i != ops_.size(); ++i) {
+    if (ops_[i] == Op::SUM) {
+      values_[i] = g_sums[i_sum++];
+    } else {
+      values_[i] = ops_[i] == Op::MAX ? g_maxes[i_max++] : -g_maxes[i_max++];
+    }
+  }
+  reduced_ = true;
+}
+
+
+double
+Reductions::operator[](int handle) const
+{
+  AMANZI_ASSERT(reduced_);
+  AMANZI_ASSERT(0 <= handle && handle < values_.size());
+  return values_[handle];
+}
+
+
+void
+Reductions::Clear()
+{
+  ops_.clear();
+  values_.clear();
+  reduced_ = false;
+}
+
+} // namespace Amanzi
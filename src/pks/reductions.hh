@@ -0,0 +1,75 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Fuses the scalar reductions of a nonlinear iteration into few collectives.
+/*!
+
+Each check of a nonlinear iteration -- admissibility, limiting of the
+correction, counts of boundary conditions -- needs a handful of global scalars.
+Reduced one at a time, each is a latency-bound collective, and at large core
+counts these dominate the cost of the check.
+
+Instead, the local values are registered with a Reductions object, which
+returns a handle to each global value.  Reduce() then reduces all registered
+values at once: sums in one collective, and maxes and mins (as maxes of
+negated values) in another, both issued non-blocking so that their latencies
+overlap.
+
+.. code-block:: c++
+
+    Reductions reductions(mesh_->getComm());
+    int min_p = reductions.Min(min_p_local);
+    int max_p = reductions.Max(max_p_local);
+    reductions.Reduce();
+    if (reductions[min_p] < -1.e9 || reductions[max_p] > 1.e8) ...
+
+A Reductions object may be reused: Clear() drops all registered values.
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+
+namespace Amanzi {
+
+class Reductions {
+ public:
+  explicit Reductions(const Teuchos::RCP<const Comm_type>& comm);
+
+  // Register a local value, returning the handle of its global value.
+  int Sum(double local) { return Register_(Op::SUM, local); }
+  int Max(double local) { return Register_(Op::MAX, local); }
+  int Min(double local) { return Register_(Op::MIN, local); }
+
+  // Reduce all registered values.  Collective.
+  void Reduce();
+
+  // Global value of a handle, valid after Reduce().
+  double operator[](int handle) const;
+
+  // Drop all registered values.
+  void Clear();
+
+ private:
+  enum class Op { SUM, MAX, MIN };
+
+  int Register_(Op op, double local);
+
+  Teuchos::RCP<const Comm_type> comm_;
+  std::vector<Op> ops_;
+  std::vector<double> values_;
+  bool reduced_;
+};
+
+} // namespace Amanzi
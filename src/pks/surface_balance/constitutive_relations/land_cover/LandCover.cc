@@ -8,6 +8,7 @@
 */
 
 //! Basic land cover/plant function type
+#include "dbc.hh"
 #include "exceptions.hh"
 #include "errors.hh"
 
@@ -101,6 +102,46 @@ getLandCover(Teuchos::ParameterList& plist, const std::vector<std::string>& requ
 }
 
 
+void
+LandCoverCells::Initialize(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                           const LandCoverMap& land_cover,
+                           const Teuchos::RCP<const AmanziMesh::Mesh>& mesh_ss,
+                           bool deformable)
+{
+  mesh_ = mesh;
+  mesh_ss_ = mesh_ss;
+  deformable_ = deformable;
+
+  cells_.clear();
+  for (const auto& lc : land_cover) {
+    auto lc_ids = mesh_->getSetEntities(
+      lc.first, AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+    cells_[lc.first].assign(lc_ids.begin(), lc_ids.end());
+  }
+
+  ss_cells_.clear();
+  area_to_volume_.clear();
+  if (mesh_ss_ != Teuchos::null) {
+    int ncells =
+      mesh_->getNumEntities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+    ss_cells_.resize(ncells);
+    for (int c = 0; c != ncells; ++c) {
+      AmanziMesh::Entity_ID f = mesh_->getEntityParent(AmanziMesh::Entity_kind::CELL, c);
+      auto cells = mesh_ss_->getFaceCells(f);
+      AMANZI_ASSERT(cells.size() == 1);
+      ss_cells_[c] = cells[0];
+    }
+
+    if (!deformable_) {
+      area_to_volume_.resize(ncells);
+      for (int c = 0; c != ncells; ++c) {
+        area_to_volume_[c] = mesh_->getCellVolume(c) / mesh_ss_->getCellVolume(ss_cells_[c]);
+      }
+    }
+  }
+}
+
+
 namespace Impl {
 
 LandCoverMap
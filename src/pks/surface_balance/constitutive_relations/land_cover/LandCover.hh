@@ -115,7 +115,11 @@ same region-based partitioning.
 #pragma once
 
 #include <map>
+#include <vector>
 #include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "Mesh.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -174,6 +178,48 @@ using LandCoverMap = std::map<std::string, LandCover>;
 LandCoverMap
 getLandCover(Teuchos::ParameterList& plist, const std::vector<std::string>& required_pars);
 
+
+
+//
+// The owned cells of each land cover's region, computed once per mesh, as
+// querying the mesh for them on every evaluation is costly.
+//
+// For evaluators coupling the surface to the subsurface, this also caches the
+// subsurface cell below each surface cell and, unless either mesh deforms,
+// the ratio of the surface cell's area to that subsurface cell's volume,
+// which converts fluxes per area into sources per volume.
+// ------------------------------------------------------------------------------------------
+class LandCoverCells {
+ public:
+  void Initialize(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                  const LandCoverMap& land_cover,
+                  const Teuchos::RCP<const AmanziMesh::Mesh>& mesh_ss = Teuchos::null,
+                  bool deformable = false);
+
+  bool initialized() const { return mesh_ != Teuchos::null; }
+
+  const std::vector<AmanziMesh::Entity_ID>& cells(const std::string& region) const
+  {
+    return cells_.at(region);
+  }
+
+  AmanziMesh::Entity_ID subsurfaceCell(AmanziMesh::Entity_ID c) const { return ss_cells_[c]; }
+
+  double areaToVolume(AmanziMesh::Entity_ID c) const
+  {
+    return deformable_ ? mesh_->getCellVolume(c) / mesh_ss_->getCellVolume(ss_cells_[c]) :
+                         area_to_volume_[c];
+  }
+
+ private:
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh_, mesh_ss_;
+  bool deformable_ = false;
+  std::map<std::string, std::vector<AmanziMesh::Entity_ID>> cells_;
+  std::vector<AmanziMesh::Entity_ID> ss_cells_;
+  std::vector<double> area_to_volume_;
+};
+
+
 namespace Impl {
 
 void
@@ -12,6 +12,7 @@
 #include "albedo_threecomponent_evaluator.hh"
 #include "seb_physics_defs.hh"
 #include "seb_physics_funcs.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -65,6 +66,7 @@ void
 AlbedoThreeComponentEvaluator::Evaluate_(const State& S,
                                          const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto mesh = S.GetMesh(domain_);
   auto tag = my_keys_.front().second;
 
@@ -82,9 +84,9 @@ AlbedoThreeComponentEvaluator::Evaluate_(const State& S,
 
   emissivity(2)->PutScalar(e_snow_);
 
+  if (!lc_cells_.initialized()) lc_cells_.Initialize(mesh, land_cover_);
   for (const auto& lc : land_cover_) {
-    auto lc_ids = mesh->getSetEntities(
-      lc.first, AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+    const auto& lc_ids = lc_cells_.cells(lc.first);
 
     for (auto c : lc_ids) {
       // albedo of the snow
@@ -108,7 +110,9 @@ AlbedoThreeComponentEvaluator::EvaluatePartialDerivative_(
   const Key& wrt_key,
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& results)
-{}
+{
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
+}
 
 
 // custom EC used to set subfield names
@@ -12,6 +12,7 @@
 #include "albedo_twocomponent_evaluator.hh"
 #include "seb_physics_defs.hh"
 #include "seb_physics_funcs.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -68,6 +69,7 @@ AlbedoTwoComponentEvaluator::AlbedoTwoComponentEvaluator(Teuchos::ParameterList&
 void
 AlbedoTwoComponentEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto mesh = S.GetMesh(domain_);
   auto tag = my_keys_.front().second;
 
@@ -86,9 +88,9 @@ AlbedoTwoComponentEvaluator::Evaluate_(const State& S, const std::vector<Composi
   auto& emissivity = *results[1]->ViewComponent("cell", false);
   emissivity(1)->PutScalar(e_snow_);
 
+  if (!lc_cells_.initialized()) lc_cells_.Initialize(mesh, land_cover_);
   for (const auto& lc : land_cover_) {
-    auto lc_ids = mesh->getSetEntities(
-      lc.first, AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+    const auto& lc_ids = lc_cells_.cells(lc.first);
 
     for (auto c : lc_ids) {
       // albedo of the snow
@@ -122,7 +124,9 @@ AlbedoTwoComponentEvaluator::EvaluatePartialDerivative_(
   const Key& wrt_key,
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& results)
-{}
+{
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
+}
 
 
 // custom EC used to set subfield names
@@ -90,6 +90,7 @@ class AlbedoTwoComponentEvaluator : public EvaluatorSecondaryMonotypeCV {
   // this is horrid, because this cannot yet live in state
   // bring on new state!
   LandCoverMap land_cover_;
+  LandCoverCells lc_cells_;
 
  private:
   static Utils::RegisteredFactory<Evaluator, AlbedoTwoComponentEvaluator> reg_;
@@ -9,6 +9,7 @@
 
 //! A subgrid model for determining the area fraction of land, water, and snow within a grid cell with subgrid microtopography.
 #include "area_fractions_threecomponent_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -48,15 +49,16 @@ void
 AreaFractionsThreeComponentEvaluator::Evaluate_(const State& S,
                                                 const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   auto mesh = result[0]->Mesh();
   auto& res = *result[0]->ViewComponent("cell", false);
   const auto& sd = *S.Get<CompositeVector>(snow_depth_key_, tag).ViewComponent("cell", false);
   const auto& pd = *S.Get<CompositeVector>(ponded_depth_key_, tag).ViewComponent("cell", false);
 
+  if (!lc_cells_.initialized()) lc_cells_.Initialize(mesh, land_cover_);
   for (const auto& lc : land_cover_) {
-    auto lc_ids = mesh->getSetEntities(
-      lc.first, AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+    const auto& lc_ids = lc_cells_.cells(lc.first);
 
     for (auto c : lc_ids) {
       // calculate area of land
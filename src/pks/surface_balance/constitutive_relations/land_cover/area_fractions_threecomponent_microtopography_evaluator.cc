@@ -10,6 +10,7 @@
 //! A subgrid model for determining the area fraction of land, water, and snow within a grid cell with subgrid microtopography.
 #include "subgrid_microtopography.hh"
 #include "area_fractions_threecomponent_microtopography_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -64,6 +65,7 @@ AreaFractionsThreeComponentMicrotopographyEvaluator::Evaluate_(
   const State& S,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   Epetra_MultiVector& res = *result[0]->ViewComponent("cell", false);
 
@@ -8,6 +8,7 @@
 */
 
 #include "area_fractions_twocomponent_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -46,14 +47,15 @@ void
 AreaFractionsTwoComponentEvaluator::Evaluate_(const State& S,
                                               const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   auto mesh = result[0]->Mesh();
   auto& res = *result[0]->ViewComponent("cell", false);
   const auto& sd = *S.Get<CompositeVector>(snow_depth_key_, tag).ViewComponent("cell", false);
 
+  if (!lc_cells_.initialized()) lc_cells_.Initialize(mesh, land_cover_);
   for (const auto& lc : land_cover_) {
-    auto lc_ids = mesh->getSetEntities(
-      lc.first, AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+    const auto& lc_ids = lc_cells_.cells(lc.first);
 
     for (auto c : lc_ids) {
       // calculate area of land
@@ -95,6 +97,7 @@ AreaFractionsTwoComponentEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   result[0]->PutScalar(0.);
   // Errors::Message msg("NotImplemented: AreaFractionsTwoComponentEvaluator currently does not provide derivatives.");
   // Exceptions::amanzi_throw(msg);
@@ -9,6 +9,7 @@
 
 //! Evaluates a net radiation balance for surface, snow, and canopy.
 #include "canopy_radiation_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -91,6 +92,7 @@ CanopyRadiationEvaluator::EnsureCompatibility_ToDeps_(State& S)
 void
 CanopyRadiationEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Epetra_MultiVector& down_sw = *results[0]->ViewComponent("cell", false);
   Epetra_MultiVector& down_lw = *results[1]->ViewComponent("cell", false);
@@ -107,9 +109,9 @@ CanopyRadiationEvaluator::Evaluate_(const State& S, const std::vector<CompositeV
 
   auto mesh = results[0]->Mesh();
 
+  if (!lc_cells_.initialized()) lc_cells_.Initialize(mesh, land_cover_);
   for (const auto& lc : land_cover_) {
-    auto lc_ids = mesh->getSetEntities(
-      lc.first, AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+    const auto& lc_ids = lc_cells_.cells(lc.first);
 
     for (auto c : lc_ids) {
       // NOTE: emissivity = absorptivity, we use e to notate both
@@ -145,6 +147,7 @@ CanopyRadiationEvaluator::EvaluatePartialDerivative_(const State& S,
                                                      const Tag& wrt_tag,
                                                      const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   for (const auto& res : results) res->PutScalar(0.);
 }
 
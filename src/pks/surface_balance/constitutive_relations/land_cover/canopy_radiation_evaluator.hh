@@ -113,6 +113,7 @@ class CanopyRadiationEvaluator : public EvaluatorSecondaryMonotypeCV {
   // this is horrid, because this cannot yet live in state
   // bring on new state!
   LandCoverMap land_cover_;
+  LandCoverCells lc_cells_;
 
  private:
   static Utils::RegisteredFactory<Evaluator, CanopyRadiationEvaluator> reg_;
@@ -13,6 +13,7 @@
 */
 
 #include "drainage_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -67,6 +68,7 @@ DrainageEvaluator::Clone() const
 void
 DrainageEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   // Pull dependencies out of state.
   const Epetra_MultiVector& wc = *S.Get<CompositeVector>(wc_key_, tag).ViewComponent("cell", false);
@@ -106,6 +108,7 @@ DrainageEvaluator::EvaluatePartialDerivative_(const State& S,
                                               const Tag& wrt_tag,
                                               const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
 
   // Pull dependencies out of state.
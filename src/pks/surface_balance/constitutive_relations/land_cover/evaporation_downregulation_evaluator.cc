@@ -13,6 +13,7 @@
 
 
 #include "evaporation_downregulation_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -46,6 +47,7 @@ void
 EvaporationDownregulationEvaluator::Evaluate_(const State& S,
                                               const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   const Epetra_MultiVector& rsoil =
     *S.Get<CompositeVector>(rsoil_key_, tag).ViewComponent("cell", false);
@@ -66,6 +68,7 @@ EvaporationDownregulationEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   if (wrt_key == pot_evap_key_) {
     const Epetra_MultiVector& rsoil =
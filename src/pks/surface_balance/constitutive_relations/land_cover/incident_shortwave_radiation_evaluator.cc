@@ -40,6 +40,7 @@ https://github.com/landlab/landlab/blob/master/landlab/components/radiation/radi
 
 #include "incident_shortwave_radiation_evaluator.hh"
 #include "incident_shortwave_radiation_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -93,6 +94,7 @@ void
 IncidentShortwaveRadiationEvaluator::Evaluate_(const State& S,
                                                const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> slope = S.GetPtr<CompositeVector>(slope_key_, tag);
   Teuchos::RCP<const CompositeVector> aspect = S.GetPtr<CompositeVector>(aspect_key_, tag);
@@ -121,6 +123,7 @@ IncidentShortwaveRadiationEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> slope = S.GetPtr<CompositeVector>(slope_key_, tag);
   Teuchos::RCP<const CompositeVector> aspect = S.GetPtr<CompositeVector>(aspect_key_, tag);
@@ -10,6 +10,7 @@
 //! Fraction of incoming water that is intercepted.
 #include "interception_fraction_evaluator.hh"
 #include "interception_fraction_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -81,6 +82,7 @@ void
 InterceptionFractionEvaluator::Evaluate_(const State& S,
                                          const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> ai = S.GetPtr<CompositeVector>(ai_key_, tag);
   Teuchos::RCP<const CompositeVector> rain = S.GetPtr<CompositeVector>(rain_key_, tag);
@@ -121,6 +123,7 @@ InterceptionFractionEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   if (wrt_key == drainage_key_) {
     Tag tag = my_keys_.front().second;
     Teuchos::RCP<const CompositeVector> ai = S.GetPtr<CompositeVector>(ai_key_, tag);
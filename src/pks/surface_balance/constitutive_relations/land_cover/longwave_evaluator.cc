@@ -25,6 +25,7 @@
 #include "seb_physics_defs.hh"
 #include "seb_physics_funcs.hh"
 #include "longwave_evaluator.hh"
+#include "ProfileTimer.hh"
 
 
 namespace Amanzi {
@@ -49,6 +50,7 @@ LongwaveEvaluator::LongwaveEvaluator(Teuchos::ParameterList& plist)
 void
 LongwaveEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   const auto& air_temp = *S.Get<CompositeVector>(air_temp_key_, tag).ViewComponent("cell", false);
   const auto& vp_air = *S.Get<CompositeVector>(vp_air_key_, tag).ViewComponent("cell", false);
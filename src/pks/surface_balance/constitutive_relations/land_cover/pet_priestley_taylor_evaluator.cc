@@ -11,6 +11,7 @@
 #include "Key.hh"
 #include "pet_priestley_taylor_evaluator.hh"
 #include "seb_physics_funcs.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -118,6 +119,7 @@ PETPriestleyTaylorEvaluator::PETPriestleyTaylorEvaluator(Teuchos::ParameterList&
 void
 PETPriestleyTaylorEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   const auto& air_temp = *S.Get<CompositeVector>(air_temp_key_, tag).ViewComponent("cell", false);
   const auto& surf_temp = *S.Get<CompositeVector>(surf_temp_key_, tag).ViewComponent("cell", false);
@@ -198,6 +200,7 @@ PETPriestleyTaylorEvaluator::EvaluatePartialDerivative_(const State& S,
                                                         const Tag& wrt_tag,
                                                         const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   if (limiter_ && wrt_key == limiter_key_) {
     const auto& limiter = *S.Get<CompositeVector>(limiter_key_, tag).ViewComponent("cell", false);
@@ -11,6 +11,7 @@
 #include "plant_wilting_factor_evaluator.hh"
 #include "plant_wilting_factor_model.hh"
 #include "LandCover.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -43,6 +44,7 @@ PlantWiltingFactorEvaluator::Clone() const
 void
 PlantWiltingFactorEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
 
   const Epetra_MultiVector& pc_v =
@@ -71,6 +73,7 @@ PlantWiltingFactorEvaluator::EvaluatePartialDerivative_(const State& S,
                                                         const Tag& wrt_tag,
                                                         const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   if (wrt_key == pc_key_) {
     const Epetra_MultiVector& pc_v =
@@ -9,6 +9,7 @@
 
 //! Evaluates a net radiation balance for surface, snow, and canopy.
 #include "radiation_balance_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -108,6 +109,7 @@ RadiationBalanceEvaluator::EnsureCompatibility_ToDeps_(State& S)
 void
 RadiationBalanceEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   Epetra_MultiVector& rad_bal_surf = *results[0]->ViewComponent("cell", false);
   Epetra_MultiVector& rad_bal_snow = *results[1]->ViewComponent("cell", false);
@@ -134,9 +136,9 @@ RadiationBalanceEvaluator::Evaluate_(const State& S, const std::vector<Composite
 
   auto mesh = results[0]->Mesh();
 
+  if (!lc_cells_.initialized()) lc_cells_.Initialize(mesh, land_cover_);
   for (const auto& lc : land_cover_) {
-    auto lc_ids = mesh->getSetEntities(
-      lc.first, AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+    const auto& lc_ids = lc_cells_.cells(lc.first);
 
     for (auto c : lc_ids) {
       // NOTE: emissivity = absorptivity, we use e to notate both
@@ -183,6 +185,7 @@ RadiationBalanceEvaluator::EvaluatePartialDerivative_(const State& S,
                                                       const Tag& wrt_tag,
                                                       const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   for (const auto& res : results) res->PutScalar(0.);
 }
 
@@ -9,6 +9,7 @@
 
 //! Provides a depth-based profile of root density.
 #include "rooting_depth_fraction_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -59,6 +60,7 @@ void
 RootingDepthFractionEvaluator::Evaluate_(const State& S,
                                          const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   const Epetra_MultiVector& cv = *S.Get<CompositeVector>(cv_key_, tag).ViewComponent("cell", false);
   const Epetra_MultiVector& surf_cv =
@@ -127,6 +129,7 @@ RootingDepthFractionEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // this should only change if the mesh deforms.  don't do that!
   result[0]->PutScalar(0.);
 }
@@ -13,6 +13,7 @@
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <limits>
 
 #include "errors.hh"
 #include "dbc.hh"
@@ -281,13 +282,14 @@ EnergyBalance
 UpdateEnergyBalanceWithSnow(const GroundProperties& surf,
                             const MetData& met,
                             const ModelParams& params,
-                            SnowProperties& snow)
+                            SnowProperties& snow,
+                            const std::string& method)
 {
   EnergyBalance eb;
 
   // snow on the ground, solve for snow temperature
   std::tie(eb.fQswIn, eb.fQlwIn) = IncomingRadiation(met, snow.albedo);
-  snow.temp = DetermineSnowTemperature(surf, met, params, snow, eb);
+  snow.temp = DetermineSnowTemperature(surf, met, params, snow, eb, method);
 
   if (snow.temp > 273.15) {
     // limit snow temp to 0, then melt with the remaining energy
@@ -359,6 +361,61 @@ UpdateEnergyBalanceWithoutSnow(const GroundProperties& surf,
   return eb;
 }
 
+// Safeguarded Newton's method for the root of the (decreasing) energy balance,
+// started from a guess.  The slope is a finite difference on the first
+// iteration and a secant thereafter.  Steps are limited in size, and kept
+// within the bracket once one is known.  Returns false if not converged, in
+// which case the caller should bracket the root instead.
+template <class F>
+bool
+findSnowTemperatureNewton_(const F& func, double guess, double tol, int max_it, double& result)
+{
+  const double max_step = 5.;
+  double lo = -std::numeric_limits<double>::max(); // residual > 0
+  double hi = std::numeric_limits<double>::max();  // residual < 0
+
+  double temp = guess;
+  double res = func(temp);
+  double temp_old = temp + 1.e-3;
+  double res_old = func(temp_old);
+
+  for (int it = 0; it != max_it; ++it) {
+    if (res == 0.) {
+      result = temp;
+      return true;
+    }
+    if (res > 0.) {
+      lo = temp;
+    } else {
+      hi = temp;
+    }
+
+    double slope = (res - res_old) / (temp - temp_old);
+    double step = slope < 0. ? -res / slope : (res > 0. ? max_step : -max_step);
+    step = std::max(-max_step, std::min(max_step, step));
+
+    double temp_new = temp + step;
+    if (temp_new <= lo || temp_new >= hi) {
+      if (lo > -std::numeric_limits<double>::max() && hi < std::numeric_limits<double>::max()) {
+        temp_new = (lo + hi) / 2.;
+      } else {
+        return false;
+      }
+    }
+    if (std::abs(temp_new - temp) < tol) {
+      result = temp_new;
+      return true;
+    }
+
+    temp_old = temp;
+    res_old = res;
+    temp = temp_new;
+    res = func(temp);
+  }
+  return false;
+}
+
+
 // Snow temperature calculation.
 double
 DetermineSnowTemperature(const GroundProperties& surf,
@@ -368,7 +425,18 @@ DetermineSnowTemperature(const GroundProperties& surf,
                          EnergyBalance& eb,
                          std::string method)
 {
+  // the incoming snow temperature, if any, is the guess for Newton
+  double guess = std::isfinite(snow.temp) ? snow.temp : surf.temp;
   SnowTemperatureFunctor_ func(&surf, &snow, &met, &params, &eb);
+  if (method == "newton") {
+    double result;
+    if (findSnowTemperatureNewton_(func, guess, ENERGY_BALANCE_TOL, 20, result)) {
+      // Call the function again to set the fluxes.
+      func(result);
+      return result;
+    }
+  }
+
   double left, right;
   double res_left, res_right;
 
@@ -410,11 +478,12 @@ DetermineSnowTemperature(const GroundProperties& surf,
     Errors::Message msg("SurfaceEnergyBalance: root finding method \"bisection\" is not longer "
                         "supported -- use \"brent\"");
     Exceptions::amanzi_throw(msg);
-  } else if (method == "brent") {
+  } else if (method == "brent" || method == "newton") {
     result = Utils::findRootBrent(func, left, right, ENERGY_BALANCE_TOL, &max_it);
   } else {
     Errors::Message emsg;
-    emsg << "SurfaceEnergyBalance: invalid solver method \"" << method << "\", use \"brent\"";
+    emsg << "SurfaceEnergyBalance: invalid solver method \"" << method
+         << "\", use \"brent\" or \"newton\"";
     Exceptions::amanzi_throw(emsg);
   }
 
@@ -169,6 +169,12 @@ UpdateEnergyBalanceWithSnow_Inner(const GroundProperties& surf,
 // Determine the snow temperature by solving for energy balance, i.e. the snow
 // temp at equilibrium.  Assumes no melting (and therefore T_snow calculated
 // can be greater than 0 C.
+//
+// Method "brent" brackets the root, stepping 1 K at a time from the ground
+// temperature, then uses Brent's method.  Method "newton" uses a safeguarded
+// Newton's method started from the incoming snow.temp, if it is set (e.g. to
+// the previous solution), or else the ground temperature, falling back to
+// "brent" if that fails to converge.
 // ------------------------------------------------------------------------------------------
 double
 DetermineSnowTemperature(const GroundProperties& surf,
@@ -188,7 +194,8 @@ EnergyBalance
 UpdateEnergyBalanceWithSnow(const GroundProperties& surf,
                             const MetData& met,
                             const ModelParams& params,
-                            SnowProperties& snow);
+                            SnowProperties& snow,
+                            const std::string& method = "brent");
 
 //
 // Update the energy balance, solving for the amount of heat conducted to the ground.
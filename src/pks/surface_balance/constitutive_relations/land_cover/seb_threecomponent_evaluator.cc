@@ -27,6 +27,7 @@ respectively.
 #include "seb_threecomponent_evaluator.hh"
 #include "seb_physics_defs.hh"
 #include "seb_physics_funcs.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -162,12 +163,21 @@ SEBThreeComponentEvaluator::SEBThreeComponentEvaluator(Teuchos::ParameterList& p
   // parameters
   min_wind_speed_ = plist.get<double>("minimum wind speed [m s^-1]", 1.0);
   wind_speed_ref_ht_ = plist.get<double>("wind speed reference height [m]", 2.0);
+
+  snow_temp_method_ = plist.get<std::string>("snow temperature solver", "brent");
+  if (snow_temp_method_ != "brent" && snow_temp_method_ != "newton") {
+    Errors::Message msg;
+    msg << "SEBEvaluator: invalid \"snow temperature solver\" \"" << snow_temp_method_
+        << "\", valid are \"brent\" and \"newton\"";
+    Exceptions::amanzi_throw(msg);
+  }
   AMANZI_ASSERT(wind_speed_ref_ht_ > 0.);
 }
 
 void
 SEBThreeComponentEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   const Relations::ModelParams params(plist_);
 
@@ -224,7 +234,6 @@ SEBThreeComponentEvaluator::Evaluate_(const State& S, const std::vector<Composit
   new_snow.PutScalar(0.);
 
   const auto& mesh = *S.GetMesh(domain_);
-  const auto& mesh_ss = *S.GetMesh(domain_ss_);
 
   Epetra_MultiVector *melt_rate(nullptr), *evap_rate(nullptr), *snow_temp(nullptr);
   Epetra_MultiVector *qE_sh(nullptr), *qE_lh(nullptr), *qE_sm(nullptr);
@@ -251,15 +260,24 @@ SEBThreeComponentEvaluator::Evaluate_(const State& S, const std::vector<Composit
   }
 
   unsigned int ncells = water_source.MyLength();
+  if (snow_temp_method_ == "newton") {
+    snow_temp_guess_.resize(
+      mesh.getNumEntities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED), NaN);
+  }
+
+  if (!lc_cells_.initialized()) {
+    lc_cells_.Initialize(S.GetMesh(domain_),
+                         land_cover_,
+                         S.GetMesh(domain_ss_),
+                         S.IsDeformableMesh(domain_) || S.IsDeformableMesh(domain_ss_));
+  }
+
   for (const auto& lc : land_cover_) {
-    auto lc_ids = mesh.getSetEntities(
-      lc.first, AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+    const auto& lc_ids = lc_cells_.cells(lc.first);
 
     for (auto c : lc_ids) {
       // get the top cell
-      AmanziMesh::Entity_ID subsurf_f = mesh.getEntityParent(AmanziMesh::Entity_kind::CELL, c);
-      auto cells = mesh_ss.getFaceCells(subsurf_f);
-      AMANZI_ASSERT(cells.size() == 1);
+      AmanziMesh::Entity_ID ss_c = lc_cells_.subsurfaceCell(c);
 
       // met data structure
       Relations::MetData met;
@@ -275,7 +293,7 @@ SEBThreeComponentEvaluator::Evaluate_(const State& S, const std::vector<Composit
       if (area_fracs[0][c] > 0.) {
         Relations::GroundProperties surf;
         surf.temp = surf_temp[0][c];
-        surf.pressure = ss_pres[0][cells[0]];
+        surf.pressure = ss_pres[0][ss_c];
         surf.roughness = lc.second.roughness_ground;
         surf.density_w = mass_dens[0][c];
         surf.albedo = sg_albedo[0][c];
@@ -305,13 +323,13 @@ SEBThreeComponentEvaluator::Evaluate_(const State& S, const std::vector<Composit
         water_source[0][c] += area_fracs[0][c] * flux.M_surf;
         energy_source[0][c] += area_fracs[0][c] * flux.E_surf * 1.e-6; // convert to MW/m^2
 
-        double area_to_volume = mesh.getCellVolume(c) / mesh_ss.getCellVolume(cells[0]);
+        double area_to_volume = lc_cells_.areaToVolume(c);
         double ss_water_source_l =
           flux.M_subsurf * area_to_volume * mol_dens[0][c]; // convert from m/m^2/s to mol/m^3/s
-        ss_water_source[0][cells[0]] += area_fracs[0][c] * ss_water_source_l;
+        ss_water_source[0][ss_c] += area_fracs[0][c] * ss_water_source_l;
         double ss_energy_source_l =
           flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
-        ss_energy_source[0][cells[0]] += area_fracs[0][c] * ss_energy_source_l;
+        ss_energy_source[0][ss_c] += area_fracs[0][c] * ss_energy_source_l;
 
         snow_source[0][c] += area_fracs[0][c] * flux.M_snow;
         new_snow[0][c] += area_fracs[0][c] * met.Ps;
@@ -373,13 +391,13 @@ SEBThreeComponentEvaluator::Evaluate_(const State& S, const std::vector<Composit
         water_source[0][c] += area_fracs[1][c] * flux.M_surf;
         energy_source[0][c] += area_fracs[1][c] * flux.E_surf * 1.e-6;
 
-        double area_to_volume = mesh.getCellVolume(c) / mesh_ss.getCellVolume(cells[0]);
+        double area_to_volume = lc_cells_.areaToVolume(c);
         double ss_water_source_l =
           flux.M_subsurf * area_to_volume * mol_dens[0][c]; // convert from m/m^2/s to mol/m^3/s
-        ss_water_source[0][cells[0]] += area_fracs[1][c] * ss_water_source_l;
+        ss_water_source[0][ss_c] += area_fracs[1][c] * ss_water_source_l;
         double ss_energy_source_l =
           flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
-        ss_energy_source[0][cells[0]] += area_fracs[1][c] * ss_energy_source_l;
+        ss_energy_source[0][ss_c] += area_fracs[1][c] * ss_energy_source_l;
 
         snow_source[0][c] += area_fracs[1][c] * flux.M_snow;
         new_snow[0][c] += area_fracs[1][c] * met.Ps;
@@ -436,9 +454,11 @@ SEBThreeComponentEvaluator::Evaluate_(const State& S, const std::vector<Composit
         snow.albedo = surf.albedo;
         snow.emissivity = surf.emissivity;
         snow.roughness = lc.second.roughness_snow;
+        if (!snow_temp_guess_.empty()) snow.temp = snow_temp_guess_[c];
 
         const Relations::EnergyBalance eb =
-          Relations::UpdateEnergyBalanceWithSnow(surf, met, params, snow);
+          Relations::UpdateEnergyBalanceWithSnow(surf, met, params, snow, snow_temp_method_);
+        if (!snow_temp_guess_.empty()) snow_temp_guess_[c] = snow.temp;
         const Relations::MassBalance mb = Relations::UpdateMassBalanceWithSnow(surf, params, eb);
         Relations::FluxBalance flux =
           Relations::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
@@ -590,6 +610,7 @@ SEBThreeComponentEvaluator::EvaluatePartialDerivative_(const State& S,
                                                        const Tag& wrt_tag,
                                                        const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   //AMANZI_ASSERT(false);
 }
 
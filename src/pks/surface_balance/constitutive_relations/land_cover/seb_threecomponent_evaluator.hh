@@ -34,6 +34,13 @@ gravity- and wind-driven redistributions, respectively.
 
    * `"save diagnostic data`" ``[bool]`` **false** Saves a suite of diagnostic variables to vis.
 
+   * `"snow temperature solver`" ``[string]`` **brent** Method for solving the
+     energy balance for the temperature of snow-covered cells.  `"brent`"
+     brackets the root from the skin temperature.  `"newton`" uses a
+     safeguarded Newton's method, warm-started from the cell's snow temperature
+     of the previous evaluation, and is much cheaper when the snow temperature
+     changes little between evaluations, e.g. across nonlinear iterations.
+
    * `"surface domain name`" ``[string]`` **DEFAULT** Default set by parameterlist name.
    * `"subsurface domain name`" ``[string]`` **DEFAULT** Default set relative to surface domain name.
    * `"snow domain name`" ``[string]`` **DEFAULT** Default set relative to surface domain name.
@@ -160,6 +167,10 @@ class SEBThreeComponentEvaluator : public EvaluatorSecondaryMonotypeCV {
   double wind_speed_ref_ht_; // reference height of the met data
 
   LandCoverMap land_cover_;
+  LandCoverCells lc_cells_;
+
+  std::string snow_temp_method_;
+  std::vector<double> snow_temp_guess_; // last snow temperature of each cell, for "newton"
 
   bool compatible_;
   bool diagnostics_;
@@ -25,6 +25,7 @@ respectively.
 #include "seb_twocomponent_evaluator.hh"
 #include "seb_physics_defs.hh"
 #include "seb_physics_funcs.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -161,12 +162,21 @@ SEBTwoComponentEvaluator::SEBTwoComponentEvaluator(Teuchos::ParameterList& plist
   // parameters
   min_wind_speed_ = plist.get<double>("minimum wind speed [m s^-1]", 1.0);
   wind_speed_ref_ht_ = plist.get<double>("wind speed reference height [m]", 2.0);
+
+  snow_temp_method_ = plist.get<std::string>("snow temperature solver", "brent");
+  if (snow_temp_method_ != "brent" && snow_temp_method_ != "newton") {
+    Errors::Message msg;
+    msg << "SEBEvaluator: invalid \"snow temperature solver\" \"" << snow_temp_method_
+        << "\", valid are \"brent\" and \"newton\"";
+    Exceptions::amanzi_throw(msg);
+  }
   AMANZI_ASSERT(wind_speed_ref_ht_ > 0.);
 }
 
 void
 SEBTwoComponentEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& results)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   const Relations::ModelParams params(plist_);
   double snow_eps = 1.e-5;
@@ -224,7 +234,6 @@ SEBTwoComponentEvaluator::Evaluate_(const State& S, const std::vector<CompositeV
   new_snow.PutScalar(0.);
 
   const auto& mesh = *S.GetMesh(domain_);
-  const auto& mesh_ss = *S.GetMesh(domain_ss_);
 
   Epetra_MultiVector *melt_rate(nullptr), *evap_rate(nullptr), *snow_temp(nullptr);
   Epetra_MultiVector *qE_sh(nullptr), *qE_lh(nullptr), *qE_sm(nullptr);
@@ -250,15 +259,24 @@ SEBTwoComponentEvaluator::Evaluate_(const State& S, const std::vector<CompositeV
     qE_cond->PutScalar(0.);
   }
 
+  if (snow_temp_method_ == "newton") {
+    snow_temp_guess_.resize(
+      mesh.getNumEntities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED), NaN);
+  }
+
+  if (!lc_cells_.initialized()) {
+    lc_cells_.Initialize(S.GetMesh(domain_),
+                         land_cover_,
+                         S.GetMesh(domain_ss_),
+                         S.IsDeformableMesh(domain_) || S.IsDeformableMesh(domain_ss_));
+  }
+
   for (const auto& lc : land_cover_) {
-    auto lc_ids = mesh.getSetEntities(
-      lc.first, AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_kind::OWNED);
+    const auto& lc_ids = lc_cells_.cells(lc.first);
 
     for (auto c : lc_ids) {
       // get the top cell
-      AmanziMesh::Entity_ID subsurf_f = mesh.getEntityParent(AmanziMesh::Entity_kind::CELL, c);
-      auto cells = mesh_ss.getFaceCells(subsurf_f);
-      AMANZI_ASSERT(cells.size() == 1);
+      AmanziMesh::Entity_ID ss_c = lc_cells_.subsurfaceCell(c);
 
       // met data structure
       Relations::MetData met;
@@ -280,7 +298,7 @@ SEBTwoComponentEvaluator::Evaluate_(const State& S, const std::vector<CompositeV
           surf.rsoil = 0.;
         } else {
           double factor = std::max(ponded_depth[0][c], 0.) / lc.second.water_transition_depth;
-          surf.pressure = factor * surf_pres[0][c] + (1 - factor) * ss_pres[0][cells[0]];
+          surf.pressure = factor * surf_pres[0][c] + (1 - factor) * ss_pres[0][ss_c];
           surf.rsoil = (1 - factor) * surf_rsoil[0][c];
         }
         if (model_1p1_) surf.pressure = surf_pres[0][c];
@@ -315,7 +333,7 @@ SEBTwoComponentEvaluator::Evaluate_(const State& S, const std::vector<CompositeV
         water_source[0][c] += area_fracs[0][c] * flux.M_surf;
         energy_source[0][c] += area_fracs[0][c] * flux.E_surf * 1.e-6; // convert to MW/m^2
 
-        double area_to_volume = mesh.getCellVolume(c) / mesh_ss.getCellVolume(cells[0]);
+        double area_to_volume = lc_cells_.areaToVolume(c);
         double ss_water_source_l;
         if (model_1p1_)
           ss_water_source_l = flux.M_subsurf * area_to_volume * surf.density_w /
@@ -323,10 +341,10 @@ SEBTwoComponentEvaluator::Evaluate_(const State& S, const std::vector<CompositeV
         else
           ss_water_source_l =
             flux.M_subsurf * area_to_volume * mol_dens[0][c]; // convert from m/s to mol/m^3/s
-        ss_water_source[0][cells[0]] += area_fracs[0][c] * ss_water_source_l;
+        ss_water_source[0][ss_c] += area_fracs[0][c] * ss_water_source_l;
         double ss_energy_source_l =
           flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
-        ss_energy_source[0][cells[0]] += area_fracs[0][c] * ss_energy_source_l;
+        ss_energy_source[0][ss_c] += area_fracs[0][c] * ss_energy_source_l;
 
         snow_source[0][c] += area_fracs[0][c] * flux.M_snow;
         new_snow[0][c] += area_fracs[0][c] * met.Ps;
@@ -384,9 +402,11 @@ SEBTwoComponentEvaluator::Evaluate_(const State& S, const std::vector<CompositeV
         snow.albedo = surf.albedo;
         snow.emissivity = surf.emissivity;
         snow.roughness = lc.second.roughness_snow;
+        if (!snow_temp_guess_.empty()) snow.temp = snow_temp_guess_[c];
 
         const Relations::EnergyBalance eb =
-          Relations::UpdateEnergyBalanceWithSnow(surf, met, params, snow);
+          Relations::UpdateEnergyBalanceWithSnow(surf, met, params, snow, snow_temp_method_);
+        if (!snow_temp_guess_.empty()) snow_temp_guess_[c] = snow.temp;
         const Relations::MassBalance mb = Relations::UpdateMassBalanceWithSnow(surf, params, eb);
         Relations::FluxBalance flux =
           Relations::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
@@ -534,7 +554,9 @@ SEBTwoComponentEvaluator::EvaluatePartialDerivative_(const State& S,
                                                      const Key& wrt_key,
                                                      const Tag& wrt_tag,
                                                      const std::vector<CompositeVector*>& results)
-{}
+{
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
+}
 
 
 void
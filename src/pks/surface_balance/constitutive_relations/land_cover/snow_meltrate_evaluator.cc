@@ -10,6 +10,7 @@
 #include "Key.hh"
 #include "snow_meltrate_evaluator.hh"
 #include "errors.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -56,6 +57,7 @@ SnowMeltRateEvaluator::EnsureCompatibility_ToDeps_(State& S)
 void
 SnowMeltRateEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   auto mesh = S.GetMesh(domain_);
 
@@ -89,6 +91,7 @@ SnowMeltRateEvaluator::EvaluatePartialDerivative_(const State& S,
                                                   const Tag& wrt_tag,
                                                   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   Tag tag = my_keys_.front().second;
   auto mesh = S.GetMesh(domain_);
   const auto& exp_temp = *S.Get<CompositeVector>(exp_temp_key_, tag).ViewComponent("cell", false);
@@ -11,6 +11,7 @@
 #include "Function.hh"
 #include "FunctionFactory.hh"
 #include "transpiration_distribution_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -85,6 +86,7 @@ void
 TranspirationDistributionEvaluator::Evaluate_(const State& S,
                                               const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
 
   // on the subsurface
@@ -152,6 +154,7 @@ TranspirationDistributionEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   result[0]->PutScalar(
     0.); // this would be a nontrivial calculation, as it is technically nonlocal due to rescaling issues?
 }
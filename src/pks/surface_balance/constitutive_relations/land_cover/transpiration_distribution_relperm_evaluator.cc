@@ -10,6 +10,7 @@
 //! Distributes and downregulates potential transpiration to the rooting zone.
 #include "Brent.hh"
 #include "transpiration_distribution_relperm_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -177,6 +178,7 @@ void
 TranspirationDistributionRelPermEvaluator::Evaluate_(const State& S,
                                                      const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
 
   // on the subsurface
@@ -290,6 +292,7 @@ TranspirationDistributionRelPermEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   // this would be a nontrivial calculation, as it is technically nonlocal due
   // to rescaling issues?
   result[0]->PutScalar(0.);
@@ -28,6 +28,7 @@
 
 #include "evaporative_flux_relaxation_evaluator.hh"
 #include "evaporative_flux_relaxation_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -84,6 +85,7 @@ void
 EvaporativeFluxRelaxationEvaluator::Evaluate_(const State& S,
                                               const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> wc = S.GetPtr<CompositeVector>(wc_key_, tag);
   Teuchos::RCP<const CompositeVector> rho = S.GetPtr<CompositeVector>(rho_key_, tag);
@@ -112,6 +114,7 @@ EvaporativeFluxRelaxationEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   auto tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> wc = S.GetPtr<CompositeVector>(wc_key_, tag);
   Teuchos::RCP<const CompositeVector> rho = S.GetPtr<CompositeVector>(rho_key_, tag);
@@ -49,6 +49,7 @@ changed on the input line.
 
 #include "micropore_macropore_flux_evaluator.hh"
 #include "micropore_macropore_flux_model.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -110,6 +111,7 @@ void
 MicroporeMacroporeFluxEvaluator::Evaluate_(const State& S,
                                            const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   auto tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> pm = S.GetPtr<CompositeVector>(pm_key_, tag);
   Teuchos::RCP<const CompositeVector> pM = S.GetPtr<CompositeVector>(pM_key_, tag);
@@ -143,6 +145,7 @@ MicroporeMacroporeFluxEvaluator::EvaluatePartialDerivative_(
   const Tag& wrt_tag,
   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   auto tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> pm = S.GetPtr<CompositeVector>(pm_key_, tag);
   Teuchos::RCP<const CompositeVector> pM = S.GetPtr<CompositeVector>(pM_key_, tag);
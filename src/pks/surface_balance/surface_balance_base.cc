@@ -10,6 +10,7 @@
 #include "pk_helpers.hh"
 
 #include "surface_balance_base.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -142,6 +143,7 @@ SurfaceBalanceBase::FunctionalResidual(double t_old,
                                        Teuchos::RCP<TreeVector> u_new,
                                        Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
   Teuchos::OSTab tab = vo_->getOSTab();
   double dt = t_new - t_old;
 
@@ -218,6 +220,7 @@ SurfaceBalanceBase::FunctionalResidual(double t_old,
 void
 SurfaceBalanceBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  Profiling::ScopedTimer timer("pk", name(), "UpdatePreconditioner");
   // update state with the solution up.
   AMANZI_ASSERT(std::abs(S_->get_time(tag_next_) - t) <= 1.e-4 * t);
   PK_Physical_Default::Solution_to_State(*up, tag_next_);
@@ -269,6 +272,7 @@ int
 SurfaceBalanceBase::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
                                         Teuchos::RCP<TreeVector> Pu)
 {
+  Profiling::ScopedTimer timer("pk", name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon application:" << std::endl;
 
@@ -23,6 +23,7 @@
 #include "pk_helpers.hh"
 #include "seb_physics_defs.hh"
 #include "surface_balance_implicit_subgrid.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -168,6 +169,7 @@ ImplicitSubgrid::FunctionalResidual(double t_old,
                                     Teuchos::RCP<TreeVector> u_new,
                                     Teuchos::RCP<TreeVector> g)
 {
+  Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
   int cycle = S_->get_cycle(tag_next_);
 
   // first calculate the "snow death rate", or rate of snow SWE that must melt over this
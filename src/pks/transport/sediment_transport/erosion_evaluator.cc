@@ -13,6 +13,7 @@
 */
 
 #include "erosion_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 
@@ -60,6 +61,7 @@ ErosionRateEvaluator ::Clone() const
 void
 ErosionRateEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   const Epetra_MultiVector& vel =
     *S.GetPtr<CompositeVector>(velocity_key_, tag)->ViewComponent("cell");
@@ -84,6 +86,7 @@ ErosionRateEvaluator::EvaluatePartialDerivative_(const State& S,
                                                  const Tag& wrt_tag,
                                                  const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(0);
 }
 
@@ -13,6 +13,7 @@
 */
 
 #include "organic_matter_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 
@@ -42,6 +43,7 @@ OrganicMatterRateEvaluator::Clone() const
 void
 OrganicMatterRateEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
   const Epetra_MultiVector& bio = *S.Get<CompositeVector>(biomass_key_, tag).ViewComponent("cell");
   Epetra_MultiVector& result_c = *result[0]->ViewComponent("cell");
@@ -59,6 +61,7 @@ OrganicMatterRateEvaluator::EvaluatePartialDerivative_(const State& S,
                                                        const Tag& wrt_tag,
                                                        const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(0);
 }
 
@@ -13,6 +13,7 @@
 */
 
 #include "trapping_evaluator.hh"
+#include "ProfileTimer.hh"
 
 namespace Amanzi {
 
@@ -57,6 +58,7 @@ TrappingRateEvaluator::Clone() const
 void
 TrappingRateEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "Evaluate_");
   Tag tag = my_keys_.front().second;
 
   const Epetra_MultiVector& vel = *S.Get<CompositeVector>(velocity_key_, tag).ViewComponent("cell");
@@ -100,6 +102,7 @@ TrappingRateEvaluator::EvaluatePartialDerivative_(const State& S,
                                                   const Tag& wrt_tag,
                                                   const std::vector<CompositeVector*>& result)
 {
+  Profiling::ScopedTimer timer("evaluator", my_keys_.front(), "EvaluatePartialDerivative_");
   AMANZI_ASSERT(0);
 }
 
@@ -0,0 +1,155 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Benchmark of the donor upwind kernel using component-major (Epetra
+  MultiVector) and cell-major (interleaved) storage of the advected
+  components.  As in Transport_ATS, the cell-major timing includes packing
+  the components into the interleaved buffers and unpacking the result.
+  Both layouts must give bitwise identical results.
+*/
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "UnitTest++.h"
+
+#include "transport_ats_advection_kernels.hh"
+
+namespace {
+
+// Cell -> face topology and upwind cells of an n x n x n structured grid
+// with a pseudo-random flux field.  Only interior faces are kept.
+struct Grid {
+  explicit Grid(int n)
+  {
+    ncells = n * n * n;
+    auto id = [n](int i, int j, int k) { return i + n * (j + n * k); };
+
+    std::vector<std::vector<int>> cell_faces(ncells);
+    for (int k = 0; k < n; ++k) {
+      for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+          int c = id(i, j, k);
+          int nbrs[3] = { i + 1 < n ? id(i + 1, j, k) : -1,
+                          j + 1 < n ? id(i, j + 1, k) : -1,
+                          k + 1 < n ? id(i, j, k + 1) : -1 };
+          for (int c2 : nbrs) {
+            if (c2 < 0) continue;
+            int f = flux.size();
+            double u = std::sin(0.37 * f + 1.0);
+            flux.push_back(u);
+            upwind_cell.push_back(u > 0 ? c : c2);
+            cell_faces[c].push_back(f);
+            cell_faces[c2].push_back(f);
+          }
+        }
+      }
+    }
+
+    offsets.assign(ncells + 1, 0);
+    for (int c = 0; c < ncells; ++c) {
+      faces.insert(faces.end(), cell_faces[c].begin(), cell_faces[c].end());
+      offsets[c + 1] = faces.size();
+    }
+  }
+
+  int ncells;
+  std::vector<int> offsets, faces, upwind_cell;
+  std::vector<double> flux;
+};
+
+} // namespace
+
+
+TEST(ADVECTION_LAYOUT_BENCHMARK)
+{
+  using namespace Amanzi::Transport;
+
+  Grid grid(24);
+  int ncells = grid.ncells;
+  double dt = 0.01;
+  int nrepeat = 10;
+
+  std::cout << "Donor upwind kernel, " << ncells << " cells, " << grid.flux.size() << " faces"
+            << std::endl
+            << std::setw(12) << "components" << std::setw(20) << "component major [s]"
+            << std::setw(20) << "cell major [s]" << std::setw(12) << "speedup" << std::endl;
+
+  for (int ncomp : { 1, 8, 32, 128 }) {
+    // component-major storage, the cell-major run keeps its own result
+    std::vector<std::vector<double>> tcc_cm(ncomp, std::vector<double>(ncells));
+    std::vector<std::vector<double>> cons_cm(ncomp, std::vector<double>(ncells, 0.));
+    std::vector<std::vector<double>> cons_out(ncomp, std::vector<double>(ncells, 0.));
+    std::vector<double*> tcc_ptr(ncomp), cons_ptr(ncomp), cons_out_ptr(ncomp);
+    for (int i = 0; i < ncomp; ++i) {
+      for (int c = 0; c < ncells; ++c) tcc_cm[i][c] = 1.0 + 0.001 * ((c * 7 + i * 13) % 1000);
+      tcc_ptr[i] = tcc_cm[i].data();
+      cons_ptr[i] = cons_cm[i].data();
+      cons_out_ptr[i] = cons_out[i].data();
+    }
+
+    // cell-major work buffers
+    std::vector<double> tcc_il(ncells * ncomp), cons_il(ncells * ncomp);
+
+    std::vector<double> water_cm(ncells, 0.), water_il(ncells, 0.);
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < nrepeat; ++n) {
+      for (int c = 0; c < ncells; ++c) {
+        Kernels::donorUpwindGatherComponentMajor(c,
+                                                 &grid.faces[grid.offsets[c]],
+                                                 &grid.faces[grid.offsets[c + 1]],
+                                                 grid.upwind_cell.data(),
+                                                 grid.flux.data(),
+                                                 dt,
+                                                 ncomp,
+                                                 tcc_ptr.data(),
+                                                 cons_ptr.data(),
+                                                 water_cm.data());
+      }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int n = 0; n < nrepeat; ++n) {
+      Kernels::packCellMajor(ncells, ncomp, tcc_ptr.data(), tcc_il.data());
+      Kernels::packCellMajor(ncells, ncomp, cons_out_ptr.data(), cons_il.data());
+      for (int c = 0; c < ncells; ++c) {
+        Kernels::donorUpwindGatherCellMajor(c,
+                                            &grid.faces[grid.offsets[c]],
+                                            &grid.faces[grid.offsets[c + 1]],
+                                            grid.upwind_cell.data(),
+                                            grid.flux.data(),
+                                            dt,
+                                            ncomp,
+                                            tcc_il.data(),
+                                            cons_il.data(),
+                                            water_il.data());
+      }
+      Kernels::unpackCellMajor(ncells, ncomp, cons_il.data(), cons_out_ptr.data());
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    double time_cm = std::chrono::duration<double>(t1 - t0).count();
+    double time_il = std::chrono::duration<double>(t2 - t1).count();
+    std::cout << std::setw(12) << ncomp << std::setw(20) << time_cm << std::setw(20) << time_il
+              << std::setw(12) << time_cm / time_il << std::endl;
+
+    // layouts differ only in storage, not in the order of operations
+    int nmismatch = 0;
+    for (int c = 0; c < ncells; ++c) {
+      if (water_cm[c] != water_il[c]) nmismatch++;
+      for (int i = 0; i < ncomp; ++i)
+        if (cons_cm[i][c] != cons_out[i][c]) nmismatch++;
+    }
+    CHECK_EQUAL(0, nmismatch);
+  }
+}
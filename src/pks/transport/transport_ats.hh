@@ -99,6 +99,36 @@ The advection-diffusion equation for component *i* in the surface may be written
    * `"transport subcycling`" ``[bool]`` **true** The code will default to
       subcycling for transport within the master PK if there is one.
 
+   * `"advection kernel`" ``[string]`` **"face loop"** Implementation of the
+      first-order donor upwind update.  One of:
+
+      - `"face loop`" : serial loop over faces, scattering the upwind flux
+        into both neighboring cells.
+      - `"cell gather`" : threaded loop over owned cells, gathering the flux
+        through each of the cell's faces.  The cell-to-face map is built once
+        per mesh and faces are visited in increasing order, so results are
+        bitwise identical to `"face loop`" for any number of threads.
+
+   * `"interleave advected components`" ``[bool]`` **false** If *true*, the
+      `"cell gather`" kernel copies advected components into cell-major
+      (components contiguous) work buffers at the start of each subcycle and
+      back at its end, so that the update through each face is a contiguous
+      loop over components.  Worthwhile with many advected components.
+      Requires `"advection kernel`" `"cell gather`".
+
+
+   * `"local time stepping`" ``[bool]`` **false** If *true*, cells are binned
+      into levels by their local CFL limit, and cells on level *k* take steps
+      of :math:`2^k` times the globally stable step.  The subcycle step
+      becomes the step of the coarsest level, and finer cells are subcycled
+      within it.  Fluxes through a face are computed once per step of the
+      finer of its two cells and applied to both, so mass is conserved at
+      level interfaces.  Only valid with first-order spatial discretization,
+      and takes precedence over the `"advection kernel`" option.
+
+   * `"local time stepping maximum level`" ``[int]`` **3** The coarsest
+      level, i.e. the largest step is :math:`2^{level}` times the globally
+      stable step.
 
    Developer parameters:
 
@@ -412,6 +442,14 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
 
   // advection members
   void AdvanceDonorUpwind(double dT);
+  void AdvanceDonorUpwindCellGather_(const Epetra_MultiVector& tcc_prev);
+  void InitializeCellFaceMap_();
+  void AdvanceDonorUpwindMultirate_(const Epetra_MultiVector& tcc_prev);
+  void ComputeCellLevels_(const std::vector<double>& dt_cell, double dt_fine);
+  void InitializeMultirateLists_();
+  void InitializeMultirateBoundary_();
+  void PackInterleaved_(const Epetra_MultiVector& tcc_prev);
+  void UnpackInterleaved_();
   void AdvanceSecondOrderUpwindRKn(double dT);
   void AdvanceSecondOrderUpwindRK1(double dT);
   void AdvanceSecondOrderUpwindRK2(double dT);
@@ -425,6 +463,9 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
 
   void IdentifyUpwindCells();
 
+  std::size_t CountBytes_(const Epetra_MultiVector& v) const;
+  std::size_t CountBytes_(const CompositeVector& v) const;
+
   void InterpolateCellVector(const Epetra_MultiVector& v0,
                              const Epetra_MultiVector& v1,
                              double dT_int,
@@ -518,11 +559,16 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
   Teuchos::RCP<CompositeVector> tcc_w_src;
   Teuchos::RCP<CompositeVector> tcc_tmp; // next tcc
   Teuchos::RCP<CompositeVector> tcc;     // smart mirrow of tcc
+  Teuchos::RCP<CompositeVector> tcc_subcycle_; // swapped with tcc_tmp between subcycles
   Teuchos::RCP<Epetra_MultiVector> conserve_qty_, solid_qty_, water_qty_;
   Teuchos::RCP<const Epetra_MultiVector> flux_;
   Teuchos::RCP<const Epetra_MultiVector> ws_, ws_prev_, phi_, mol_dens_, mol_dens_prev_;
   Teuchos::RCP<Epetra_MultiVector> flux_copy_;
 
+  // work memory of the subcycling loop, allocated on first use
+  Teuchos::RCP<Epetra_Vector> f_component_, ws_ratio_;
+  std::size_t bytes_allocated_; // work memory allocated in the current AdvanceStep
+
 #ifdef ALQUIMIA_ENABLED
   Teuchos::RCP<AmanziChemistry::Alquimia_PK> chem_pk_;
   Teuchos::RCP<AmanziChemistry::ChemistryEngine> chem_engine_;
@@ -531,6 +577,34 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
   Teuchos::RCP<Epetra_IntVector> upwind_cell_;
   Teuchos::RCP<Epetra_IntVector> downwind_cell_;
 
+  // owned cell -> face map (CSR, faces sorted) for the cell gather kernel
+  bool advect_cell_gather_;
+  std::vector<int> cell_face_offsets_;
+  std::vector<int> cell_face_list_;
+  std::vector<int> boundary_faces_owned_; // boundary faces of owned cells
+
+  // local time stepping: level of each cell (owned and ghost)
+  bool lts_;
+  int lts_max_level_, lts_level_;
+  Teuchos::RCP<CompositeVector> cell_level_;
+
+  // local time stepping work memory, rebuilt when the levels change: owned
+  // cells, faces and boundary entries binned by level (offsets[l] is the
+  // start of level l), and the sources over the full step
+  bool lts_lists_valid_;
+  int lts_ghost_level_; // finest level of ghost cells over all ranks
+  std::vector<int> lts_cell_level_, lts_face_level_;
+  std::vector<int> lts_cell_offsets_, lts_cell_list_;
+  std::vector<int> lts_face_offsets_, lts_face_list_;
+  std::vector<int> lts_bc_offsets_, lts_bc_face_, lts_bc_comp_;
+  std::vector<double> lts_bc_value_;
+  Teuchos::RCP<Epetra_MultiVector> lts_src_qty_;
+
+  // cell-major work buffers for the advection sweep
+  bool advect_interleaved_;
+  std::vector<double> tcc_interleaved_;
+  std::vector<double> cons_interleaved_;
+
   Teuchos::RCP<const Epetra_MultiVector> ws_current, ws_next;             // data for subcycling
   Teuchos::RCP<const Epetra_MultiVector> mol_dens_current, mol_dens_next; // data for subcycling
   Teuchos::RCP<Epetra_MultiVector> ws_subcycle_current, ws_subcycle_next;
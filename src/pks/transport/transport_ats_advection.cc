@@ -0,0 +1,362 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Transport PK
+
+  Threaded donor upwind kernel.  Rather than scattering the flux through
+  each face into both neighbors, each owned cell gathers the fluxes through
+  its own faces, so cells can be updated concurrently without races.  The
+  per-cell kernels themselves live in transport_ats_advection_kernels.hh.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Kokkos_Core.hpp"
+
+#include "Mesh.hh"
+#include "transport_ats.hh"
+#include "transport_ats_advection_kernels.hh"
+
+namespace Amanzi {
+namespace Transport {
+
+/* *******************************************************************
+* Builds the owned cell -> face map used by the cell gather kernel.
+* Faces of each cell are sorted so that every cell sees its fluxes in
+* the same order as the serial face loop, which makes the two kernels
+* bitwise identical.
+******************************************************************* */
+void
+Transport_ATS::InitializeCellFaceMap_()
+{
+  cell_face_offsets_.assign(ncells_owned + 1, 0);
+  cell_face_list_.clear();
+  boundary_faces_owned_.clear();
+
+  for (int c = 0; c < ncells_owned; c++) {
+    auto faces = mesh_->getCellFaces(c);
+    int n0 = cell_face_list_.size();
+    for (int i = 0; i < faces.size(); i++) {
+      int f = faces[i];
+      cell_face_list_.push_back(f);
+      if (mesh_->getFaceCells(f).size() == 1) boundary_faces_owned_.push_back(f);
+    }
+    std::sort(cell_face_list_.begin() + n0, cell_face_list_.end());
+    cell_face_offsets_[c + 1] = cell_face_list_.size();
+  }
+
+  std::sort(boundary_faces_owned_.begin(), boundary_faces_owned_.end());
+}
+
+
+/* *******************************************************************
+* Accumulates advective fluxes of all advected components and water
+* into conserve_qty_ by looping over owned cells in parallel.
+*
+* If requested, components are first packed into cell-major work
+* buffers so that the update of each face is contiguous in memory, and
+* unpacked back into conserve_qty_ once the sweep is done.
+******************************************************************* */
+void
+Transport_ATS::AdvanceDonorUpwindCellGather_(const Epetra_MultiVector& tcc_prev)
+{
+  const double* flux = (*flux_)[0];
+  const int* upwind_cell = upwind_cell_->Values();
+  double* water = (*conserve_qty_)[tcc_prev.NumVectors() + 1];
+
+  const double dt = dt_;
+  const int n_advect = num_advect;
+  const int* offsets = cell_face_offsets_.data();
+  const int* face_list = cell_face_list_.data();
+
+  if (advect_interleaved_) {
+    PackInterleaved_(tcc_prev);
+    const double* tcc = tcc_interleaved_.data();
+    double* cons = cons_interleaved_.data();
+
+    Kokkos::parallel_for(
+      "Transport_ATS::AdvanceDonorUpwindCellGather",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, ncells_owned),
+      [=](const int c) {
+        Kernels::donorUpwindGatherCellMajor(c,
+                                            face_list + offsets[c],
+                                            face_list + offsets[c + 1],
+                                            upwind_cell,
+                                            flux,
+                                            dt,
+                                            n_advect,
+                                            tcc,
+                                            cons,
+                                            water);
+      });
+
+    UnpackInterleaved_();
+  } else {
+    const double* const* tcc = tcc_prev.Pointers();
+    double* const* cons = conserve_qty_->Pointers();
+
+    Kokkos::parallel_for(
+      "Transport_ATS::AdvanceDonorUpwindCellGather",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, ncells_owned),
+      [=](const int c) {
+        Kernels::donorUpwindGatherComponentMajor(c,
+                                                 face_list + offsets[c],
+                                                 face_list + offsets[c + 1],
+                                                 upwind_cell,
+                                                 flux,
+                                                 dt,
+                                                 n_advect,
+                                                 tcc,
+                                                 cons,
+                                                 water);
+      });
+  }
+
+  // mass leaving through the domain boundary, reduced in face order
+  for (int f : boundary_faces_owned_) {
+    int c1 = upwind_cell[f];
+    if (c1 >= 0 && (*downwind_cell_)[f] < 0) {
+      double u = fabs(flux[f]);
+      for (int i = 0; i < n_advect; i++) mass_solutes_bc_[i] -= dt * u * tcc_prev[i][c1];
+    }
+  }
+}
+
+
+/* *******************************************************************
+* Local time stepping version of the donor upwind flux sweep.
+*
+* The step dt_ is split into 2^L fine steps, L being the coarsest level
+* in use.  A face is active every 2^l fine steps, l being the finer of
+* its two cell levels, and moves dt_f * u * tcc_upwind through the face
+* for dt_f = 2^l fine steps.  The amount is applied to both cells, so
+* mass is conserved at level interfaces.  Boundary inflow of solutes is
+* applied with the same dt_f as the inflow of water, and each cell gets
+* its share of the source terms at the end of each of its own steps,
+* when its concentration is updated from its conserved quantity and
+* water.  Work concentrations are kept in tcc_tmp.  With a single level
+* this is exactly the face loop of AdvanceDonorUpwind().
+*
+* Faces and cells are binned by level when the levels change, so each
+* fine step touches only the active ones, and ghost concentrations are
+* only communicated after steps that end on a level of a ghost cell.
+******************************************************************* */
+void
+Transport_ATS::AdvanceDonorUpwindMultirate_(const Epetra_MultiVector& tcc_prev)
+{
+  auto capacity = [this]() {
+    return sizeof(int) * (lts_cell_level_.capacity() + lts_face_level_.capacity() +
+                          lts_cell_offsets_.capacity() + lts_cell_list_.capacity() +
+                          lts_face_offsets_.capacity() + lts_face_list_.capacity() +
+                          lts_bc_offsets_.capacity() + lts_bc_face_.capacity() +
+                          lts_bc_comp_.capacity()) +
+           sizeof(double) * lts_bc_value_.capacity();
+  };
+  std::size_t capacity0 = capacity();
+  if (!lts_lists_valid_) InitializeMultirateLists_();
+  InitializeMultirateBoundary_();
+  bytes_allocated_ += capacity() - capacity0;
+
+  Epetra_MultiVector& tcc_work = *tcc_tmp->ViewComponent("cell", true);
+  int i_water = tcc_prev.NumVectors() + 1;
+
+  for (int i = 0; i < num_advect; i++) tcc_work(i)->Update(1., *tcc_prev(i), 0.);
+
+  int nsteps = 1 << lts_level_;
+  double dt_fine = dt_ / nsteps;
+
+  // source mass over the full step, distributed over the cell steps
+  if (srcs_.size() != 0) {
+    if (lts_src_qty_ == Teuchos::null) {
+      lts_src_qty_ = Teuchos::rcp(
+        new Epetra_MultiVector(conserve_qty_->Map(), conserve_qty_->NumVectors()));
+      bytes_allocated_ += CountBytes_(*lts_src_qty_);
+    }
+    lts_src_qty_->PutScalar(0.);
+    ComputeAddSourceTerms(t_physics_, dt_, *lts_src_qty_, 0, num_aqueous - 1);
+  }
+
+  const int* upwind_cell = upwind_cell_->Values();
+  const int* downwind_cell = downwind_cell_->Values();
+  const double* flux = (*flux_)[0];
+  const double* const* src = srcs_.size() != 0 ? lts_src_qty_->Pointers() : nullptr;
+  double* const* tcc = tcc_work.Pointers();
+  double* const* cons = conserve_qty_->Pointers();
+  double* water = (*conserve_qty_)[i_water];
+  const int* faces = lts_face_list_.data();
+  const int* cells = lts_cell_list_.data();
+
+  for (int n = 0; n < nsteps; n++) {
+    int l_start = Kernels::multirateActiveLevel(n, lts_level_);
+    for (int l = 0; l <= l_start; l++) {
+      double dt_f = (1 << l) * dt_fine;
+      Kernels::multirateFaceFluxes(faces + lts_face_offsets_[l],
+                                   faces + lts_face_offsets_[l + 1],
+                                   ncells_owned,
+                                   upwind_cell,
+                                   downwind_cell,
+                                   flux,
+                                   dt_f,
+                                   num_advect,
+                                   tcc,
+                                   cons,
+                                   water,
+                                   mass_solutes_bc_.data());
+      Kernels::multirateBoundaryInflow(lts_bc_offsets_[l + 1] - lts_bc_offsets_[l],
+                                       lts_bc_face_.data() + lts_bc_offsets_[l],
+                                       lts_bc_comp_.data() + lts_bc_offsets_[l],
+                                       lts_bc_value_.data() + lts_bc_offsets_[l],
+                                       downwind_cell,
+                                       flux,
+                                       dt_f,
+                                       cons,
+                                       mass_solutes_bc_.data());
+    }
+
+    int l_end = Kernels::multirateActiveLevel(n + 1, lts_level_);
+    for (int l = 0; l <= l_end; l++) {
+      Kernels::multirateCellStepEnd(cells + lts_cell_offsets_[l],
+                                    cells + lts_cell_offsets_[l + 1],
+                                    (double)(1 << l) / nsteps,
+                                    n < nsteps - 1,
+                                    num_advect,
+                                    src,
+                                    cons,
+                                    water,
+                                    water_tolerance_,
+                                    tcc);
+    }
+
+    if (n < nsteps - 1 && l_end >= lts_ghost_level_) tcc_tmp->ScatterMasterToGhosted("cell");
+  }
+
+  // sources of components that are not advected
+  if (src) {
+    for (int i = num_advect; i < num_aqueous; i++) {
+      (*conserve_qty_)(i)->Update(1., *(*lts_src_qty_)(i), 1.);
+    }
+  }
+}
+
+
+/* *******************************************************************
+* Bins owned cells and all faces by level, a face being on the finer
+* level of its cells, and finds the finest level of ghost cells, which
+* decides when ghost concentrations change.  Collective.
+******************************************************************* */
+void
+Transport_ATS::InitializeMultirateLists_()
+{
+  const Epetra_MultiVector& level = *cell_level_->ViewComponent("cell", true);
+
+  lts_cell_level_.resize(ncells_wghost);
+  for (int c = 0; c < ncells_wghost; c++) {
+    lts_cell_level_[c] = std::min((int)level[0][c], lts_level_);
+  }
+
+  lts_face_level_.assign(nfaces_wghost, lts_level_);
+  for (int f = 0; f < nfaces_wghost; f++) {
+    auto cells = mesh_->getFaceCells(f);
+    for (int i = 0; i < cells.size(); i++) {
+      lts_face_level_[f] = std::min(lts_face_level_[f], lts_cell_level_[cells[i]]);
+    }
+  }
+
+  Kernels::multirateBinByLevel(
+    ncells_owned, lts_cell_level_.data(), lts_level_, lts_cell_offsets_, lts_cell_list_);
+  Kernels::multirateBinByLevel(
+    nfaces_wghost, lts_face_level_.data(), lts_level_, lts_face_offsets_, lts_face_list_);
+
+  int ghost_level = lts_level_ + 1;
+  for (int c = ncells_owned; c < ncells_wghost; c++) {
+    ghost_level = std::min(ghost_level, lts_cell_level_[c]);
+  }
+  mesh_->getComm()->MinAll(&ghost_level, &lts_ghost_level_, 1);
+  lts_lists_valid_ = true;
+}
+
+
+/* *******************************************************************
+* Flattens the boundary concentrations of advected components into
+* (face, component, value) entries binned by face level.  Values change
+* on every step, so this runs on every call, reusing the storage.
+******************************************************************* */
+void
+Transport_ATS::InitializeMultirateBoundary_()
+{
+  lts_bc_offsets_.assign(lts_level_ + 2, 0);
+  for (int m = 0; m < bcs_.size(); m++) {
+    std::vector<int>& tcc_index = bcs_[m]->tcc_index();
+    for (auto it = bcs_[m]->begin(); it != bcs_[m]->end(); ++it) {
+      for (int i = 0; i < tcc_index.size(); i++) {
+        if (tcc_index[i] < num_advect) lts_bc_offsets_[lts_face_level_[it->first] + 1]++;
+      }
+    }
+  }
+  for (int l = 0; l <= lts_level_; l++) lts_bc_offsets_[l + 1] += lts_bc_offsets_[l];
+
+  int nentries = lts_bc_offsets_[lts_level_ + 1];
+  lts_bc_face_.resize(nentries);
+  lts_bc_comp_.resize(nentries);
+  lts_bc_value_.resize(nentries);
+
+  for (int m = 0; m < bcs_.size(); m++) {
+    std::vector<int>& tcc_index = bcs_[m]->tcc_index();
+    for (auto it = bcs_[m]->begin(); it != bcs_[m]->end(); ++it) {
+      for (int i = 0; i < tcc_index.size(); i++) {
+        if (tcc_index[i] < num_advect) {
+          int j = lts_bc_offsets_[lts_face_level_[it->first]]++;
+          lts_bc_face_[j] = it->first;
+          lts_bc_comp_[j] = tcc_index[i];
+          lts_bc_value_[j] = it->second[i];
+        }
+      }
+    }
+  }
+
+  // filling shifted each offset to the start of the next level
+  for (int l = lts_level_; l > 0; l--) lts_bc_offsets_[l] = lts_bc_offsets_[l - 1];
+  lts_bc_offsets_[0] = 0;
+}
+
+
+/* *******************************************************************
+* Copies advected components of tcc (owned and ghost cells) and of the
+* conserved quantity (owned cells) into cell-major work buffers.
+******************************************************************* */
+void
+Transport_ATS::PackInterleaved_(const Epetra_MultiVector& tcc_prev)
+{
+  int n = num_advect;
+  std::size_t capacity = tcc_interleaved_.capacity() + cons_interleaved_.capacity();
+  tcc_interleaved_.resize((std::size_t)ncells_wghost * n);
+  cons_interleaved_.resize((std::size_t)ncells_owned * n);
+  bytes_allocated_ +=
+    sizeof(double) * (tcc_interleaved_.capacity() + cons_interleaved_.capacity() - capacity);
+
+  Kernels::packCellMajor(ncells_wghost, n, tcc_prev.Pointers(), tcc_interleaved_.data());
+  Kernels::packCellMajor(ncells_owned, n, conserve_qty_->Pointers(), cons_interleaved_.data());
+}
+
+
+/* *******************************************************************
+* Copies the cell-major conserved quantity back into conserve_qty_.
+******************************************************************* */
+void
+Transport_ATS::UnpackInterleaved_()
+{
+  Kernels::unpackCellMajor(
+    ncells_owned, num_advect, cons_interleaved_.data(), conserve_qty_->Pointers());
+}
+
+} // namespace Transport
+} // namespace Amanzi
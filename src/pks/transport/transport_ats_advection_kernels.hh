@@ -0,0 +1,269 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Transport PK
+
+  Donor upwind kernels, shared by Transport_ATS and its tests.
+
+  Each kernel gathers, for one cell c, the advective flux through its faces
+  [faces_begin, faces_end) into the conserved quantity of every component
+  and into the water balance.  Two storage layouts are supported:
+
+  - component major: tcc[i][c], one array per component, which is how
+    Epetra_MultiVector stores data.
+  - cell major (interleaved): tcc[c * ncomp + i], so that the inner loop
+    over components is a contiguous, vectorizable update.
+*/
+
+#ifndef AMANZI_ATS_TRANSPORT_ADVECTION_KERNELS_HH_
+#define AMANZI_ATS_TRANSPORT_ADVECTION_KERNELS_HH_
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Amanzi {
+namespace Transport {
+namespace Kernels {
+
+inline void
+donorUpwindGatherComponentMajor(int c,
+                                const int* faces_begin,
+                                const int* faces_end,
+                                const int* upwind_cell,
+                                const double* flux,
+                                double dt,
+                                int ncomp,
+                                const double* const* tcc,
+                                double* const* cons,
+                                double* water)
+{
+  for (const int* fp = faces_begin; fp != faces_end; ++fp) {
+    int f = *fp;
+    int c1 = upwind_cell[f];
+    double u = fabs(flux[f]);
+
+    if (c1 == c) {
+      for (int i = 0; i < ncomp; i++) cons[i][c] -= dt * u * tcc[i][c];
+      water[c] -= dt * u;
+    } else {
+      if (c1 >= 0) {
+        for (int i = 0; i < ncomp; i++) cons[i][c] += dt * u * tcc[i][c1];
+      }
+      water[c] += dt * u;
+    }
+  }
+}
+
+
+inline void
+donorUpwindGatherCellMajor(int c,
+                           const int* faces_begin,
+                           const int* faces_end,
+                           const int* upwind_cell,
+                           const double* flux,
+                           double dt,
+                           int ncomp,
+                           const double* __restrict__ tcc,
+                           double* __restrict__ cons,
+                           double* water)
+{
+  double* cons_c = cons + (long)c * ncomp;
+  for (const int* fp = faces_begin; fp != faces_end; ++fp) {
+    int f = *fp;
+    int c1 = upwind_cell[f];
+    double u = fabs(flux[f]);
+
+    if (c1 == c) {
+      const double* tcc_c = tcc + (long)c * ncomp;
+      for (int i = 0; i < ncomp; i++) cons_c[i] -= dt * u * tcc_c[i];
+      water[c] -= dt * u;
+    } else {
+      if (c1 >= 0) {
+        const double* tcc_c1 = tcc + (long)c1 * ncomp;
+        for (int i = 0; i < ncomp; i++) cons_c[i] += dt * u * tcc_c1[i];
+      }
+      water[c] += dt * u;
+    }
+  }
+}
+
+
+// copies the first ncells entries of ncomp component-major arrays into a
+// cell-major buffer, and back
+inline void
+packCellMajor(int ncells, int ncomp, const double* const* x, double* x_il)
+{
+  for (int i = 0; i < ncomp; i++) {
+    const double* x_i = x[i];
+    for (int c = 0; c < ncells; c++) x_il[(long)c * ncomp + i] = x_i[c];
+  }
+}
+
+
+inline void
+unpackCellMajor(int ncells, int ncomp, const double* x_il, double* const* x)
+{
+  for (int i = 0; i < ncomp; i++) {
+    double* x_i = x[i];
+    for (int c = 0; c < ncells; c++) x_i[c] = x_il[(long)c * ncomp + i];
+  }
+}
+
+
+/*
+  Local time stepping kernels, see Transport_ATS::AdvanceDonorUpwindMultirate_().
+
+  Faces, cells and boundary entries are binned by level, a face being on
+  the finer level of its two cells.  Entities of level l take steps of
+  2^l fine steps, so those active on a fine step are the levels up to
+  multirateActiveLevel(), a prefix of the binned list.  Each kernel is
+  called per level, on the range of that level.  Boundary inflow of
+  solutes is applied together with the inflow of water, so that
+  concentrations recovered between fine steps are not diluted.
+*/
+
+// Coarsest level whose steps start on fine step n (or, for n = nsteps,
+// end on fine step n - 1), capped at max_level.
+inline int
+multirateActiveLevel(int n, int max_level)
+{
+  int l = 0;
+  while (l < max_level && !((n >> l) & 1)) l++;
+  return l;
+}
+
+
+// Stable counting sort of entities 0..n-1 by level: entities of level l
+// are list[offsets[l], offsets[l + 1]), in increasing order.  Vectors are
+// resized in place, so their storage is reused.
+inline void
+multirateBinByLevel(int n,
+                    const int* level,
+                    int max_level,
+                    std::vector<int>& offsets,
+                    std::vector<int>& list)
+{
+  offsets.assign(max_level + 2, 0);
+  for (int e = 0; e < n; e++) offsets[level[e] + 1]++;
+  for (int l = 0; l <= max_level; l++) offsets[l + 1] += offsets[l];
+
+  list.resize(offsets[max_level + 1]);
+  for (int e = 0; e < n; e++) list[offsets[level[e]]++] = e;
+
+  // filling shifted each offset to the start of the next level
+  for (int l = max_level; l > 0; l--) offsets[l] = offsets[l - 1];
+  offsets[0] = 0;
+}
+
+
+// Moves dt_f * u * tcc_upwind through faces [faces_begin, faces_end).
+inline void
+multirateFaceFluxes(const int* faces_begin,
+                    const int* faces_end,
+                    int ncells_owned,
+                    const int* upwind_cell,
+                    const int* downwind_cell,
+                    const double* flux,
+                    double dt_f,
+                    int ncomp,
+                    const double* const* tcc,
+                    double* const* cons,
+                    double* water,
+                    double* mass_bc)
+{
+  for (const int* it = faces_begin; it != faces_end; ++it) {
+    int f = *it;
+    int c1 = upwind_cell[f];
+    int c2 = downwind_cell[f];
+    double u = fabs(flux[f]);
+
+    if (c1 >= 0 && c1 < ncells_owned && c2 >= 0 && c2 < ncells_owned) {
+      for (int i = 0; i < ncomp; i++) {
+        double tcc_flux = dt_f * u * tcc[i][c1];
+        cons[i][c1] -= tcc_flux;
+        cons[i][c2] += tcc_flux;
+      }
+      water[c1] -= dt_f * u;
+      water[c2] += dt_f * u;
+    } else if (c1 >= 0 && c1 < ncells_owned && (c2 >= ncells_owned || c2 < 0)) {
+      for (int i = 0; i < ncomp; i++) {
+        double tcc_flux = dt_f * u * tcc[i][c1];
+        cons[i][c1] -= tcc_flux;
+        if (c2 < 0) mass_bc[i] -= tcc_flux;
+      }
+      water[c1] -= dt_f * u;
+    } else if (c1 >= ncells_owned && c2 >= 0 && c2 < ncells_owned) {
+      for (int i = 0; i < ncomp; i++) cons[i][c2] += dt_f * u * tcc[i][c1];
+      water[c2] += dt_f * u;
+    } else if (c1 < 0 && c2 >= 0 && c2 < ncells_owned) {
+      water[c2] += dt_f * u;
+    }
+  }
+}
+
+
+// Boundary data are flattened into (face, component, value) entries.
+inline void
+multirateBoundaryInflow(int nentries,
+                        const int* bc_face,
+                        const int* bc_comp,
+                        const double* bc_value,
+                        const int* downwind_cell,
+                        const double* flux,
+                        double dt_f,
+                        double* const* cons,
+                        double* mass_bc)
+{
+  for (int j = 0; j < nentries; j++) {
+    int f = bc_face[j];
+    if (downwind_cell[f] < 0) continue;
+
+    int i = bc_comp[j];
+    double tcc_flux = dt_f * fabs(flux[f]) * bc_value[j];
+    cons[i][downwind_cell[f]] += tcc_flux;
+    mass_bc[i] += tcc_flux;
+  }
+}
+
+
+// Cells [cells_begin, cells_end), reaching the end of their own step,
+// receive the fraction of the source mass src, integrated over the full
+// step, and, if recover, their work concentration.  The final
+// concentration is recovered by the caller.
+inline void
+multirateCellStepEnd(const int* cells_begin,
+                     const int* cells_end,
+                     double fraction,
+                     bool recover,
+                     int ncomp,
+                     const double* const* src,
+                     double* const* cons,
+                     const double* water,
+                     double water_tolerance,
+                     double* const* tcc)
+{
+  for (const int* it = cells_begin; it != cells_end; ++it) {
+    int c = *it;
+    if (src) {
+      for (int i = 0; i < ncomp; i++) cons[i][c] += fraction * src[i][c];
+    }
+
+    if (recover && water[c] > water_tolerance) {
+      for (int i = 0; i < ncomp; i++) tcc[i][c] = std::max(cons[i][c], 0.) / water[c];
+    }
+  }
+}
+
+} // namespace Kernels
+} // namespace Transport
+} // namespace Amanzi
+
+#endif
@@ -43,6 +43,40 @@ Transport_ATS::InitializeAll_()
   temporal_disc_order = plist_->get<int>("temporal discretization order", 1);
   if (temporal_disc_order < 1 || temporal_disc_order > 2) temporal_disc_order = 1;
 
+  std::string kernel = plist_->get<std::string>("advection kernel", "face loop");
+  if (kernel == "face loop") {
+    advect_cell_gather_ = false;
+  } else if (kernel == "cell gather") {
+    advect_cell_gather_ = true;
+  } else {
+    Errors::Message msg;
+    msg << "Transport PK: unknown \"advection kernel\" \"" << kernel
+        << "\", valid are \"face loop\" and \"cell gather\".";
+    Exceptions::amanzi_throw(msg);
+  }
+  advect_interleaved_ = plist_->get<bool>("interleave advected components", false);
+  if (advect_interleaved_ && !advect_cell_gather_) {
+    Errors::Message msg;
+    msg << "Transport PK: \"interleave advected components\" requires \"advection kernel\" "
+        << "\"cell gather\".";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  lts_ = plist_->get<bool>("local time stepping", false);
+  lts_max_level_ = plist_->get<int>("local time stepping maximum level", 3);
+  lts_level_ = 0;
+  lts_lists_valid_ = false;
+  if (lts_ && spatial_disc_order != 1) {
+    Errors::Message msg(
+      "Transport PK: \"local time stepping\" requires \"spatial discretization order\" 1.");
+    Exceptions::amanzi_throw(msg);
+  }
+  if (lts_max_level_ < 0 || lts_max_level_ > 20) {
+    Errors::Message msg(
+      "Transport PK: \"local time stepping maximum level\" must be in [0, 20].");
+    Exceptions::amanzi_throw(msg);
+  }
+
   num_aqueous = plist_->get<int>("number of aqueous components", component_names_.size());
   num_advect = plist_->get<int>("number of aqueous components advected", num_aqueous);
   num_gaseous = plist_->get<int>("number of gaseous components", 0);
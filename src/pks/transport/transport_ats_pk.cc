@@ -427,6 +427,14 @@ Transport_ATS::Initialize()
   upwind_cell_ = Teuchos::rcp(new Epetra_IntVector(fmap_wghost));
   downwind_cell_ = Teuchos::rcp(new Epetra_IntVector(fmap_wghost));
   IdentifyUpwindCells();
+  if (advect_cell_gather_) InitializeCellFaceMap_();
+
+  if (lts_) {
+    CompositeVectorSpace cvs;
+    cvs.SetMesh(mesh_)->SetGhosted(true)->SetComponent("cell", AmanziMesh::Entity_kind::CELL, 1);
+    cell_level_ = Teuchos::rcp(new CompositeVector(cvs));
+    cell_level_->PutScalar(0.);
+  }
 
   // advection block initialization
   current_component_ = -1;
@@ -728,6 +736,9 @@ Transport_ATS::StableTimeStep()
   dt_ = TRANSPORT_LARGE_TIME_STEP;
   double dt_cell = TRANSPORT_LARGE_TIME_STEP;
   int cmin_dt = 0;
+  std::vector<double> dt_cells;
+  if (lts_) dt_cells.assign(ncells_owned, TRANSPORT_LARGE_TIME_STEP);
+
   for (int c = 0; c < ncells_owned; c++) {
     double outflux = total_outflux[c];
 
@@ -735,6 +746,7 @@ Transport_ATS::StableTimeStep()
       vol = mesh_->getCellVolume(c);
       dt_cell = vol * (*mol_dens_)[0][c] * (*phi_)[0][c] *
                 std::min((*ws_prev_)[0][c], (*ws_)[0][c]) / outflux;
+      if (lts_) dt_cells[c] = dt_cell;
     }
     if (dt_cell < dt_) {
       dt_ = dt_cell;
@@ -792,10 +804,59 @@ Transport_ATS::StableTimeStep()
                << tmp_package[0] << " and "
                << "output flux " << tmp_package[1] << std::endl;
   }
+
+  if (lts_) ComputeCellLevels_(dt_cells, dt_);
   return dt_;
 }
 
 
+/* *******************************************************************
+* Local time stepping: bins owned cells into levels such that a cell on
+* level k is stable with steps of 2^k * dt_fine, then scales dt_ up to
+* the step of the coarsest level in use.
+******************************************************************* */
+void
+Transport_ATS::ComputeCellLevels_(const std::vector<double>& dt_cells, double dt_fine)
+{
+  // the coarsest step may not exceed the developer's limit
+  int max_level = lts_max_level_;
+  while (max_level > 0 && dt_fine * (1 << max_level) > dt_debug_ * cfl_) max_level--;
+
+  Epetra_MultiVector& level = *cell_level_->ViewComponent("cell", false);
+  std::vector<int> ncells_level(lts_max_level_ + 1, 0);
+  int level_max_local = 0;
+
+  for (int c = 0; c < ncells_owned; c++) {
+    double ratio = dt_cells[c] * cfl_ / dt_fine;
+    int k = 0;
+    while (k < max_level && ratio >= 2.0) {
+      ratio /= 2;
+      k++;
+    }
+    level[0][c] = k;
+    ncells_level[k]++;
+    level_max_local = std::max(level_max_local, k);
+  }
+  cell_level_->ScatterMasterToGhosted("cell");
+
+  const Epetra_Comm& comm = *mesh_->getComm();
+  comm.MaxAll(&level_max_local, &lts_level_, 1);
+  dt_ = dt_fine * (1 << lts_level_);
+  lts_lists_valid_ = false;
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    std::vector<int> ncells_level_global(ncells_level.size());
+    comm.SumAll(ncells_level.data(), ncells_level_global.data(), ncells_level.size());
+
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "Local time stepping: " << lts_level_ + 1 << " levels, step " << dt_
+               << ", cells per level:";
+    for (int k = 0; k <= lts_level_; k++) *vo_->os() << " " << ncells_level_global[k];
+    *vo_->os() << std::endl;
+  }
+}
+
+
 /* *******************************************************************
 * Estimate returns last time step unless it is zero.
 ******************************************************************* */
@@ -821,6 +882,7 @@ Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
 {
   bool failed = false;
   double dt_MPC = t_new - t_old;
+  bytes_allocated_ = 0;
 
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_LOW))
@@ -956,6 +1018,10 @@ Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
     }
   }
 
+  // Subcycles alternate between writing into the State's NEXT vector and a
+  // PK-owned buffer of the same structure, swapped by pointer.
+  Teuchos::RCP<CompositeVector> tcc_next_state = tcc_tmp;
+
   int ncycles = 0, swap = 1;
   while (dt_sum < dt_MPC - 1e-6) {
     // update boundary conditions
@@ -1011,14 +1077,26 @@ Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
       AdvanceSecondOrderUpwindRK2(dt_cycle);
     }
 
-    if (!final_cycle) { // rotate concentrations (we need new memory for tcc)
-      // should not be allocating here, we have tons of memory for tcc --ETC
-      tcc = Teuchos::RCP<CompositeVector>(new CompositeVector(*tcc_tmp));
+    if (!final_cycle) { // rotate concentrations by swapping work buffers
+      if (tcc_subcycle_ == Teuchos::null) {
+        tcc_subcycle_ = Teuchos::rcp(new CompositeVector(*tcc_tmp));
+        bytes_allocated_ += CountBytes_(*tcc_subcycle_);
+      } else if (ncycles == 0) {
+        // the partner buffer must carry the non-advected components
+        *tcc_subcycle_ = *tcc_tmp;
+      }
+      tcc = tcc_tmp;
+      tcc_tmp = (tcc_tmp == tcc_next_state) ? tcc_subcycle_ : tcc_next_state;
     }
 
     ncycles++;
   }
 
+  // the final subcycle may have written into the PK-owned buffer
+  if (tcc_tmp != tcc_next_state) {
+    *tcc_next_state = *tcc_tmp;
+    tcc_tmp = tcc_next_state;
+  }
   dt_ = dt_stable; // restore the original time step (just in case)
 
   Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", false);
@@ -1030,7 +1108,8 @@ Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
   nsubcycles = ncycles;
   if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
     *vo_->os() << ncycles << " sub-cycles, dt_stable=" << units_.OutputTime(dt_stable)
-               << " [sec]  dt_MPC=" << units_.OutputTime(dt_MPC) << " [sec]" << std::endl;
+               << " [sec]  dt_MPC=" << units_.OutputTime(dt_MPC) << " [sec]" << std::endl
+               << "work memory allocated: " << bytes_allocated_ << " [bytes]" << std::endl;
 
     VV_PrintSoluteExtrema(tcc_next, dt_MPC);
   }
@@ -1301,40 +1380,46 @@ Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
   mesh_->getComm()->SumAll(&tmp1, &mass_current, 1);
 
   // advance all components at once
-  for (int f = 0; f < nfaces_wghost; f++) { // loop over master and slave faces
-    int c1 = (*upwind_cell_)[f];
-    int c2 = (*downwind_cell_)[f];
-    double u = fabs((*flux_)[0][f]);
-
-    if (c1 >= 0 && c1 < ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      for (int i = 0; i < num_advect; i++) {
-        double tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c1] -= tcc_flux;
-        (*conserve_qty_)[i][c2] += tcc_flux;
-      }
-      (*conserve_qty_)[num_components + 1][c1] -= dt_ * u;
-      (*conserve_qty_)[num_components + 1][c2] += dt_ * u;
-    } else if (c1 >= 0 && c1 < ncells_owned && (c2 >= ncells_owned || c2 < 0)) {
-      for (int i = 0; i < num_advect; i++) {
-        double tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c1] -= tcc_flux;
-        if (c2 < 0) mass_solutes_bc_[i] -= tcc_flux;
-        //AmanziGeometry::Point normal = mesh_->getFaceNormal(f);
-      }
-      (*conserve_qty_)[num_components + 1][c1] -= dt_ * u;
+  if (lts_) {
+    AdvanceDonorUpwindMultirate_(tcc_prev);
+  } else if (advect_cell_gather_) {
+    AdvanceDonorUpwindCellGather_(tcc_prev);
+  } else {
+    for (int f = 0; f < nfaces_wghost; f++) { // loop over master and slave faces
+      int c1 = (*upwind_cell_)[f];
+      int c2 = (*downwind_cell_)[f];
+      double u = fabs((*flux_)[0][f]);
 
-    } else if (c1 >= ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      for (int i = 0; i < num_advect; i++) {
-        double tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c2] += tcc_flux;
-      }
-      (*conserve_qty_)[num_components + 1][c2] += dt_ * u;
+      if (c1 >= 0 && c1 < ncells_owned && c2 >= 0 && c2 < ncells_owned) {
+        for (int i = 0; i < num_advect; i++) {
+          double tcc_flux = dt_ * u * tcc_prev[i][c1];
+          (*conserve_qty_)[i][c1] -= tcc_flux;
+          (*conserve_qty_)[i][c2] += tcc_flux;
+        }
+        (*conserve_qty_)[num_components + 1][c1] -= dt_ * u;
+        (*conserve_qty_)[num_components + 1][c2] += dt_ * u;
+      } else if (c1 >= 0 && c1 < ncells_owned && (c2 >= ncells_owned || c2 < 0)) {
+        for (int i = 0; i < num_advect; i++) {
+          double tcc_flux = dt_ * u * tcc_prev[i][c1];
+          (*conserve_qty_)[i][c1] -= tcc_flux;
+          if (c2 < 0) mass_solutes_bc_[i] -= tcc_flux;
+          //AmanziGeometry::Point normal = mesh_->getFaceNormal(f);
+        }
+        (*conserve_qty_)[num_components + 1][c1] -= dt_ * u;
+
+      } else if (c1 >= ncells_owned && c2 >= 0 && c2 < ncells_owned) {
+        for (int i = 0; i < num_advect; i++) {
+          double tcc_flux = dt_ * u * tcc_prev[i][c1];
+          (*conserve_qty_)[i][c2] += tcc_flux;
+        }
+        (*conserve_qty_)[num_components + 1][c2] += dt_ * u;
 
-    } else if (c2 < 0 && c1 >= 0 && c1 < ncells_owned) {
-      (*conserve_qty_)[num_components + 1][c1] -= dt_ * u;
+      } else if (c2 < 0 && c1 >= 0 && c1 < ncells_owned) {
+        (*conserve_qty_)[num_components + 1][c1] -= dt_ * u;
 
-    } else if (c1 < 0 && c2 >= 0 && c2 < ncells_owned) {
-      (*conserve_qty_)[num_components + 1][c2] += dt_ * u;
+      } else if (c1 < 0 && c2 >= 0 && c2 < ncells_owned) {
+        (*conserve_qty_)[num_components + 1][c2] += dt_ * u;
+      }
     }
   }
 
@@ -1361,9 +1446,12 @@ Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
         for (int i = 0; i < ncomp; i++) {
           int k = tcc_index[i];
           if (k < num_advect) {
-            double tcc_flux = dt_ * u * values[i];
-            (*conserve_qty_)[k][c2] += tcc_flux;
-            mass_solutes_bc_[k] += tcc_flux;
+            // local time stepping applies the boundary mass with each fine step
+            if (!lts_) {
+              double tcc_flux = dt_ * u * values[i];
+              (*conserve_qty_)[k][c2] += tcc_flux;
+              mass_solutes_bc_[k] += tcc_flux;
+            }
 
             if (tcc_tmp_bf) (*tcc_tmp_bf)[i][bf] = values[i];
           }
@@ -1373,8 +1461,8 @@ Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
   }
   db_->WriteCellVector("cons (adv)", *conserve_qty_);
 
-  // process external sources
-  if (srcs_.size() != 0) {
+  // process external sources, already applied by local time stepping
+  if (srcs_.size() != 0 && !lts_) {
     double time = t_physics_;
     ComputeAddSourceTerms(time, dt_, *conserve_qty_, 0, num_aqueous - 1);
   }
@@ -1541,14 +1629,19 @@ Transport_ATS::AdvanceSecondOrderUpwindRK2(double dt_cycle)
 
   // work memory
   const Epetra_Map& cmap_wghost = mesh_->getMap(AmanziMesh::Entity_kind::CELL, true);
-  Epetra_Vector f_component(cmap_wghost); //,  f_component2(cmap_wghost);
+  if (f_component_ == Teuchos::null) {
+    f_component_ = Teuchos::rcp(new Epetra_Vector(cmap_wghost));
+    ws_ratio_ = Teuchos::rcp(new Epetra_Vector(*(*ws_current)(0)));
+    bytes_allocated_ += CountBytes_(*f_component_) + CountBytes_(*ws_ratio_);
+  }
+  Epetra_Vector& f_component = *f_component_;
 
   // distribute old vector of concentrations
   tcc->ScatterMasterToGhosted("cell");
   Epetra_MultiVector& tcc_prev = *tcc->ViewComponent("cell", true);
   Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", true);
 
-  Epetra_Vector ws_ratio(Copy, *ws_current, 0);
+  Epetra_Vector& ws_ratio = *ws_ratio_;
   for (int c = 0; c < ncells_owned; c++) {
     if ((*ws_next)[0][c] > 1e-10) {
       if ((*ws_current)[0][c] > 1e-10) {
@@ -1808,6 +1901,25 @@ Transport_ATS::InterpolateCellVector(const Epetra_MultiVector& v0,
   v_int.Update(b, v0, a, v1, 0.);
 }
 
+/* *******************************************************************
+* Size of work memory, used to report allocations in AdvanceStep.
+******************************************************************* */
+std::size_t
+Transport_ATS::CountBytes_(const Epetra_MultiVector& v) const
+{
+  return sizeof(double) * v.MyLength() * v.NumVectors();
+}
+
+
+std::size_t
+Transport_ATS::CountBytes_(const CompositeVector& v) const
+{
+  std::size_t bytes = 0;
+  for (const auto& comp : v) bytes += CountBytes_(*v.ViewComponent(comp, true));
+  return bytes;
+}
+
+
 void
 Transport_ATS::ChangedSolutionPK(const Tag& tag)
 {
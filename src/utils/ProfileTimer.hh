@@ -0,0 +1,136 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*!
+
+Scoped timers of the work done by each PK and each evaluator.
+
+A ScopedTimer times, and counts calls to, the enclosing scope of a method of
+a named PK or evaluator, e.g.
+
+.. code-block:: c++
+
+    Profiling::ScopedTimer timer("pk", name(), "FunctionalResidual");
+
+Timers are Teuchos timers labeled "profile: CATEGORY: NAME: METHOD", and are
+reported across ranks by the Coordinator at the end of a run.  A method that
+calls itself, or the same method of a base class, is timed and counted once.
+
+Profiling is off unless enabled by the cycle driver's "profile" option; while
+off, a ScopedTimer does nothing.  Only the thread that enabled profiling is
+timed, as timers are not thread-safe; time spent in scopes on other threads,
+e.g. subdomains advanced in parallel, counts toward the enclosing scope of
+the enabling thread.
+
+*/
+#pragma once
+
+#include <map>
+#include <string>
+#include <thread>
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_Time.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+
+#include "Key.hh"
+
+namespace Amanzi {
+namespace Profiling {
+
+// prefix of all timer labels
+inline const std::string&
+prefix()
+{
+  static const std::string p("profile: ");
+  return p;
+}
+
+namespace Impl {
+
+struct Switch {
+  bool on = false;
+  std::thread::id thread;
+};
+
+inline Switch&
+getSwitch()
+{
+  static Switch s;
+  return s;
+}
+
+} // namespace Impl
+
+// turns profiling on or off, for the calling thread
+inline void
+enable(bool on)
+{
+  Impl::getSwitch().on = on;
+  Impl::getSwitch().thread = std::this_thread::get_id();
+}
+
+// is profiling on for the calling thread?
+inline bool
+enabled()
+{
+  const Impl::Switch& s = Impl::getSwitch();
+  return s.on && s.thread == std::this_thread::get_id();
+}
+
+
+class ScopedTimer {
+ public:
+  ScopedTimer(const std::string& category, const std::string& name, const std::string& method)
+    : entry_(nullptr)
+  {
+    if (!enabled()) return;
+    entry_ = &getEntry_(category + ": " + name + ": " + method);
+    if (entry_->depth++ == 0) {
+      entry_->timer->start();
+      entry_->timer->incrementNumCalls();
+    }
+  }
+
+  ScopedTimer(const std::string& category, const KeyTag& key, const std::string& method)
+    : ScopedTimer(category, enabled() ? Keys::getKey(key.first, key.second) : Key(), method)
+  {}
+
+  ScopedTimer(const ScopedTimer& other) = delete;
+  ScopedTimer& operator=(const ScopedTimer& other) = delete;
+
+  ~ScopedTimer()
+  {
+    if (entry_ != nullptr && --entry_->depth == 0) entry_->timer->stop();
+  }
+
+ private:
+  struct Entry {
+    Teuchos::RCP<Teuchos::Time> timer;
+    int depth = 0;
+  };
+
+  static Entry& getEntry_(const std::string& name)
+  {
+    static std::map<std::string, Entry> entries;
+    Entry& entry = entries[name];
+    if (entry.timer == Teuchos::null) {
+      // getNewCounter() does not return an existing counter of the same name
+      std::string label = prefix() + name;
+      entry.timer = Teuchos::TimeMonitor::lookupCounter(label);
+      if (entry.timer == Teuchos::null) entry.timer = Teuchos::TimeMonitor::getNewCounter(label);
+    }
+    return entry;
+  }
+
+  Entry* entry_;
+};
+
+} // namespace Profiling
+} // namespace Amanzi
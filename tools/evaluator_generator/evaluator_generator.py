@@ -20,7 +20,7 @@ def render(tname, d):
     
 class EvalGen(object):
     def __init__(self, name, namespace, descriptor, my_key=None, expression=None,
-                 doc=None, **kwargs):
+                 doc=None, fused=False, ad=False, **kwargs):
         self.d = {}
         self.setName(name, **kwargs)
         self.setNamespace(namespace, **kwargs)
@@ -36,6 +36,8 @@ class EvalGen(object):
         self.par_names = []
         self.par_defaults = []
         self.expression = expression
+        self.ad = ad
+        self.fused = fused or ad
         if doc is not None:
             self.d['docDict'] = doc
         else:
@@ -98,21 +100,62 @@ class EvalGen(object):
     def renderMyMethodDeclarationArgs(self):
         return ", ".join(["double %s"%var for var in self.vars])
 
+    def renderMyMethodTemplateArgs(self):
+        return ", ".join(["const Scalar& %s"%var for var in self.vars])
+
+    def renderMyDualArgs(self):
+        return ", ".join(["Dual<%d>::Variable(%s_v[0][i], %d)"%(len(self.vars),var,i)
+                          for i,var in enumerate(self.vars)])
+
+    def wrtMethod(self, arg):
+        return ''.join([word[0].upper()+word[1:] for word in arg.split("_")])
+
     def renderEvaluateModel(self):
         d = dict()
         d['keyEpetraVectorList'] = self.renderKeyEpetraVector()
         d['myKeyMethod'] = self.d['myKeyMethod']
         d['myMethodArgs'] = self.renderMyMethodArgs()
-        return render('evaluator_evaluateModel.cc', d)
+        if not self.fused:
+            return render('evaluator_evaluateModel.cc', d)
+
+        # value and partial derivatives in one sweep
+        d['derivViewList'] = '\n'.join([render('evaluator_derivView.cc', dict(var=var, index=i))
+                                        for i,var in enumerate(self.vars)])
+        if self.ad:
+            # all partial derivatives from one evaluation on dual numbers
+            d['nDeps'] = len(self.vars)
+            d['myDualArgs'] = self.renderMyDualArgs()
+            d['derivDualList'] = '\n'.join([render('evaluator_derivDual.cc', dict(var=var, index=i))
+                                            for i,var in enumerate(self.vars)])
+            return render('evaluator_evalLoopDual.cc', d)
+
+        d['derivEvalList'] = '\n'.join([render('evaluator_derivEval.cc',
+                                               dict(var=var, myKeyMethod=self.d['myKeyMethod'],
+                                                    wrtMethod=self.wrtMethod(arg),
+                                                    myMethodArgs=d['myMethodArgs']))
+                                        for arg,var in zip(self.args,self.vars)])
+        return render('evaluator_evalLoop.cc', d)
 
     def renderEvaluateDerivs(self):
+        if self.ad:
+            # the same dual number evaluation as in the value sweep
+            wrt_index = '\n'.join(["  if (wrt_key == %s_key_) wrt = %d;"%(var,i)
+                                   for i,var in enumerate(self.vars)])
+            d = dict(keyEpetraVectorList=self.renderKeyEpetraVector(),
+                     myKeyMethod=self.d['myKeyMethod'],
+                     nDeps=len(self.vars),
+                     myDualArgs=self.renderMyDualArgs())
+            return render('evaluator_derivCacheLookup.cc', dict(wrtIndexList=wrt_index)) \
+                + render('evaluator_derivLoopDual.cc', d) \
+                + render('evaluator_derivCacheStore.cc', dict())
+
         wrt_list = []
 
         def getDict(arg,var):
             d = dict(arg=arg,var=var)
             d['keyEpetraVectorList'] = self.renderKeyEpetraVectorIndented()
             d['myKeyMethod'] = self.d['myKeyMethod']
-            d['wrtMethod'] = ''.join([word[0].upper()+word[1:] for word in arg.split("_")])
+            d['wrtMethod'] = self.wrtMethod(arg)
             d['myMethodArgs'] = self.renderMyMethodArgs()
             return d
         
@@ -128,10 +171,16 @@ class EvalGen(object):
                 wrt_list.append(render('evaluator_evaluateDerivs.cc', d))
 
         wrt_list.append('\n'.join(["  } else {",
-                                   "    ASSERT(0);",
+                                   "    AMANZI_ASSERT(0);",
                                    "  }"]))
 
-        return "\n\n".join(wrt_list)
+        derivs = "\n\n".join(wrt_list)
+        if self.fused:
+            wrt_index = '\n'.join(["  if (wrt_key == %s_key_) wrt = %d;"%(var,i)
+                                   for i,var in enumerate(self.vars)])
+            derivs = render('evaluator_derivCacheLookup.cc', dict(wrtIndexList=wrt_index)) \
+                + derivs + render('evaluator_derivCacheStore.cc', dict())
+        return derivs
                             
     def renderModelMethodDeclaration(self):
         return render('model_declaration.hh', dict(myMethod=self.d['myKeyMethod'],
@@ -146,12 +195,28 @@ class EvalGen(object):
         if self.expression is not None:
             implementation = ccode(self.expression)
         else:
-            implementation = "ASSERT(False)"
+            implementation = "AMANZI_ASSERT(false)"
         return render('model_methodImplementation.cc', dict(evalClassName=self.d['evalClassName'],
                                                             myMethod=self.d['myKeyMethod'],
                                                             myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'],
                                                             myMethodImplementation=implementation))
 
+    def renderModelTemplateImplementation(self):
+        if not self.ad:
+            return ''
+        if self.expression is not None:
+            implementation = ccode(self.expression)
+        else:
+            implementation = "AMANZI_ASSERT(false)"
+
+        # math functions are found by argument-dependent lookup for Dual
+        usings = ''.join(['    using std::%s;\n'%f for f in ['exp', 'log', 'pow', 'sqrt', 'fabs', 'tanh']
+                          if f+'(' in implementation])
+        return render('model_templateImplementation.hh', dict(myMethod=self.d['myKeyMethod'],
+                                                              myMethodTemplateArgs=self.renderMyMethodTemplateArgs(),
+                                                              usingList=usings,
+                                                              myMethodImplementation=implementation))
+
     def renderModelDerivImplementations(self):
         impls = []
 
@@ -160,7 +225,7 @@ class EvalGen(object):
                 print("differentiation of", self.expression, "with respect to", var)
                 implementation = ccode(self.expression.diff(var))
             else:
-                implementation = "ASSERT(False)"
+                implementation = "AMANZI_ASSERT(false)"
             impls.append(render('model_methodImplementation.cc',
                                 dict(evalClassName=self.d['evalClassName'],
                                      myMethod="D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")])),
@@ -181,6 +246,27 @@ class EvalGen(object):
 
         return '\n'.join(p_inits)
 
+    def renderAD(self):
+        if self.ad:
+            self.d['adInclude'] = '#include "Dual.hh"\n'
+            self.d['adModelInclude'] = '\n#include <cmath>\n'
+        else:
+            self.d['adInclude'] = ''
+            self.d['adModelInclude'] = ''
+
+    def renderFused(self):
+        if self.fused:
+            self.d['fusedInclude'] = '#include "PartialDerivativeCache.hh"\n'
+            self.d['fusedInitializer'] = ', dresult_cache_(%d)'%len(self.vars)
+            self.d['fusedDeclaration'] = '\n'.join(["",
+                                                    "  // partial derivatives computed with the value",
+                                                    "  PartialDerivativeCache dresult_cache_;",
+                                                    ""])
+        else:
+            self.d['fusedInclude'] = ''
+            self.d['fusedInitializer'] = ''
+            self.d['fusedDeclaration'] = ''
+
     def genArgs(self):
         # dependencies
         self.d['keyDeclarationList'] = self.renderKeyDeclaration()
@@ -194,12 +280,15 @@ class EvalGen(object):
         self.d['evaluateDerivs'] = self.renderEvaluateDerivs()
 
         self.d['modelMethodDeclaration'] = self.renderModelMethodDeclaration()
+        self.d['modelTemplateImplementation'] = self.renderModelTemplateImplementation()
         self.d['modelDerivDeclarationList'] = self.renderModelDerivDeclarations()
         self.d['paramDeclarationList'] = self.renderModelParamDeclarations()
 
         self.d['modelMethodImplementation'] = self.renderModelMethodImplementation()
         self.d['modelDerivImplementationList'] = self.renderModelDerivImplementations()
         self.d['modelInitializeParamsList'] = self.renderModelParamInitializations()
+        self.renderFused()
+        self.renderAD()
 
 def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parameters, **kwargs):
     """Generates an evaluator whose class is [name]Evaluator and model is [name]Model.
@@ -231,6 +320,24 @@ def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parame
 
       directory: directory where output files are created
 
+      fused: if True, the evaluator computes the partial derivatives that
+             have been requested in the same sweep as the value, and caches
+             them until the next evaluation.  Useful for evaluators with
+             many dependencies, whose partial derivatives are otherwise each
+             a separate sweep over all dependencies.  Requires
+             PartialDerivativeCache.hh, in src/constitutive_relations/generic_evaluators.
+
+      ad: if True, implies fused, and the model's method is also written as
+          a template over the scalar type.  When any partial derivative is
+          needed, the evaluator evaluates it once on dual numbers, getting
+          the value and the full gradient together, instead of calling the
+          model's partial derivative methods one at a time.  A partial
+          derivative not yet computed with the value is computed the same
+          way, so that results do not depend on the order of requests.  The
+          model's partial derivative methods are still generated, for other
+          callers and for testing.  Requires Dual.hh, in
+          src/constitutive_relations/generic_evaluators.
+
     Outputs:
       writes files: [name]_evaluator.hh
                     [name]_evaluator.cc
@@ -15,63 +15,44 @@
 
 */
 
-#ifndef AMANZI_{ namespaceCaps } _{ evalNameCaps } _EVALUATOR_HH_
-#define AMANZI_ { namespaceCaps } _{ evalNameCaps } _EVALUATOR_HH_
+#pragma once
 
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
+{fusedInclude}
+namespace Amanzi {{
+namespace {namespace} {{
+namespace Relations {{
 
-namespace Amanzi {
-{
-  namespace {namespace}
-  {
-    {
-      namespace Relations {
-      {
-        class {
-          evalClassName
-        } Model;
+class {evalClassName}Model;
 
-        class {
-          evalClassName
-        } Evaluator : public EvaluatorSecondaryMonotypeCV{ {
+class {evalClassName}Evaluator : public EvaluatorSecondaryMonotypeCV {{
+ public:
+  explicit {evalClassName}Evaluator(Teuchos::ParameterList& plist);
+  {evalClassName}Evaluator(const {evalClassName}Evaluator& other) = default;
 
-          public : explicit { evalClassName } Evaluator(Teuchos::ParameterList & plist);
-        { evalClassName } Evaluator(const { evalClassName } Evaluator & other);
+  virtual Teuchos::RCP<Evaluator> Clone() const override;
 
-        virtual Teuchos::RCP<Evaluator> Clone() const;
+  Teuchos::RCP<{evalClassName}Model> get_model() {{ return model_; }}
 
-        // Required methods from EvaluatorSecondaryMonotypeCV
-        virtual void EvaluateField_(const Teuchos::Ptr<State>& S,
-                                    const Teuchos::Ptr<CompositeVector>& result);
-        virtual void EvaluateFieldPartialDerivative_(
-          const Teuchos::Ptr<State>& S, Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
+ protected:
+  // Required methods from EvaluatorSecondaryMonotypeCV
+  virtual void Evaluate_(const State& S, const std::vector<CompositeVector*>& result) override;
+  virtual void EvaluatePartialDerivative_(const State& S,
+                                          const Key& wrt_key,
+                                          const Tag& wrt_tag,
+                                          const std::vector<CompositeVector*>& result) override;
 
-        Teuchos::RCP<{ evalClassName } Model> get_model()
-        {
-          {
-            return model_;
-          }
-        }
+  void InitializeFromPlist_();
 
-       protected:
-        void InitializeFromPlist_();
+{keyDeclarationList}
 
-        { keyDeclarationList }
+  Teuchos::RCP<{evalClassName}Model> model_;
+{fusedDeclaration}
+ private:
+  static Utils::RegisteredFactory<Evaluator, {evalClassName}Evaluator> reg_;
+}};
 
-        Teuchos::RCP<{ evalClassName } Model>
-          model_;
-
-       private:
-        static Utils::RegisteredFactory<Evaluator, { evalClassName } Evaluator> reg_;
-
-      }  // namespace Relations
-      }; // namespace Relations
-    }
-  } // namespace }
-} // namespace Amanzi
-} // namespace Amanzi
-}
-} //namespace
-
-#endif
+}} // namespace Relations
+}} // namespace {namespace}
+}} // namespace Amanzi
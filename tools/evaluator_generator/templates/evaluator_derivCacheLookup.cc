@@ -0,0 +1,8 @@
+  // partial derivatives computed with the value are copied
+  int wrt = -1;
+{wrtIndexList}
+  if (wrt >= 0 && dresult_cache_.Has(wrt)) {{
+    *result[0] = dresult_cache_.Get(wrt);
+    return;
+  }}
+
@@ -0,0 +1,4 @@
+
+
+  // from now on, computed with the value
+  if (wrt >= 0) dresult_cache_.Set(wrt, *result[0]);
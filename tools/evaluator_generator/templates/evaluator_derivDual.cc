@@ -0,0 +1 @@
+        if (dresult_{var}) dresult_{var}[i] = r.d({index});
@@ -0,0 +1,3 @@
+      if (dresult_{var}) {{
+        dresult_{var}[i] = model_->D{myKeyMethod}D{wrtMethod}({myMethodArgs});
+      }}
@@ -0,0 +1,14 @@
+
+  // otherwise computed as with the value, on dual numbers, so that values do
+  // not depend on the order of requests
+  AMANZI_ASSERT(wrt >= 0);
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {{
+{keyEpetraVectorList}
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+
+    int ncomp = result[0]->size(*comp, false);
+    for (int i = 0; i != ncomp; ++i) {{
+      Dual<{nDeps}> r = model_->{myKeyMethod}({myDualArgs});
+      result_v[0][i] = r.d(wrt);
+    }}
+  }}
@@ -0,0 +1 @@
+    double* dresult_{var} = dresult_cache_.View({index}, *comp);
@@ -0,0 +1,21 @@
+  // partial derivatives that have been requested are computed in the same
+  // sweep as the value, all at once by evaluating the model on dual numbers
+  dresult_cache_.Invalidate();
+  bool derivs = !dresult_cache_.Empty();
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {{
+{keyEpetraVectorList}
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+{derivViewList}
+
+    int ncomp = result[0]->size(*comp, false);
+    for (int i = 0; i != ncomp; ++i) {{
+      if (derivs) {{
+        Dual<{nDeps}> r = model_->{myKeyMethod}({myDualArgs});
+        result_v[0][i] = r.value();
+{derivDualList}
+      }} else {{
+        result_v[0][i] = model_->{myKeyMethod}({myMethodArgs});
+      }}
+    }}
+  }}
+  dresult_cache_.Validate();
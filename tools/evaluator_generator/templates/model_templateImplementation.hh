@@ -0,0 +1,9 @@
+
+  // The same, templated on the scalar type, so that evaluating on Dual
+  // numbers gives the value and all partial derivatives at once.
+  template <typename Scalar>
+  Scalar {myMethod}({myMethodTemplateArgs}) const
+  {{
+{usingList}    return {myMethodImplementation};
+  }}
+